@@ -32,5 +32,6 @@ constexpr inline libMcu::mpuBaseAddress mpuAddress{0xE000'ED90UL};         /**<
 #include "nvic_ll.hpp"
 #include "scb_ll.hpp"
 #include "mpu_ll.hpp"
+#include "vector_table_ll.hpp"
 
 #endif
\ No newline at end of file
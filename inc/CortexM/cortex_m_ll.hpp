@@ -83,6 +83,49 @@ __attribute__((always_inline)) static inline void dmb() {
   asm volatile inline("dmb 0xF" ::: "memory");
 }
 
+/**
+ * @brief Disable interrupts
+ *
+ * Sets PRIMASK, all exceptions with configurable priority are masked.
+ *
+ */
+__attribute__((always_inline)) static inline void disableInterrupts() {
+  asm volatile inline("cpsid i" ::: "memory");
+}
+
+/**
+ * @brief Enable interrupts
+ *
+ * Clears PRIMASK, exceptions with configurable priority are no longer masked.
+ *
+ */
+__attribute__((always_inline)) static inline void enableInterrupts() {
+  asm volatile inline("cpsie i" ::: "memory");
+}
+
+/**
+ * @brief Get priority mask
+ *
+ * @return PRIMASK register value, 1 when interrupts are disabled
+ */
+__attribute__((always_inline)) static inline std::uint32_t getPrimask() {
+  std::uint32_t result;
+
+  asm volatile inline("mrs %0, primask" : "=r"(result));
+  return result;
+}
+
+/**
+ * @brief Set priority mask
+ *
+ * Use with getPrimask to restore the interrupt state after a critical section.
+ *
+ * @param value PRIMASK register value
+ */
+__attribute__((always_inline)) static inline void setPrimask(std::uint32_t value) {
+  asm volatile inline("msr primask, %0" ::"r"(value) : "memory");
+}
+
 /**
  * @brief Reverse byte order
  *
@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file data watchpoint and trace register interface, Cortex M3/M4/M7 only
+ */
+#ifndef DWT_HW_HPP
+#define DWT_HW_HPP
+
+namespace libMcuHw {
+constexpr inline libMcu::dwtBaseAddress dwtAddress{0xE000'1000UL}; /**< DWT base address */
+constexpr inline libMcu::dcbBaseAddress dcbAddress{0xE000'EDF0UL}; /**< debug control block base address */
+}  // namespace libMcuHw
+
+namespace libMcuHw::dwt {
+struct dwt {
+  volatile std::uint32_t CTRL;       /**< control register */
+  volatile std::uint32_t CYCCNT;     /**< cycle count register */
+  volatile std::uint32_t CPICNT;     /**< CPI count register */
+  volatile std::uint32_t EXCCNT;     /**< exception overhead count register */
+  volatile std::uint32_t SLEEPCNT;   /**< sleep count register */
+  volatile std::uint32_t LSUCNT;     /**< load store unit count register */
+  volatile std::uint32_t FOLDCNT;    /**< folded instruction count register */
+  volatile const std::uint32_t PCSR; /**< program counter sample register */
+};
+namespace CTRL {
+constexpr inline std::uint32_t CYCCNTENA = (1 << 0);    /**< enable the cycle counter */
+constexpr inline std::uint32_t CPIEVTENA = (1 << 17);   /**< enable the CPI counter */
+constexpr inline std::uint32_t EXCEVTENA = (1 << 18);   /**< enable the exception overhead counter */
+constexpr inline std::uint32_t SLEEPEVTENA = (1 << 19); /**< enable the sleep counter */
+constexpr inline std::uint32_t LSUEVTENA = (1 << 20);   /**< enable the load store unit counter */
+constexpr inline std::uint32_t FOLDEVTENA = (1 << 21);  /**< enable the folded instruction counter */
+constexpr inline std::uint32_t NOCYCCNT = (1 << 25);    /**< cycle counter is not implemented */
+}  // namespace CTRL
+}  // namespace libMcuHw::dwt
+
+namespace libMcuHw::dcb {
+struct dcb {
+  volatile std::uint32_t DHCSR; /**< debug halting control and status register */
+  volatile std::uint32_t DCRSR; /**< debug core register selector register */
+  volatile std::uint32_t DCRDR; /**< debug core register data register */
+  volatile std::uint32_t DEMCR; /**< debug exception and monitor control register */
+};
+namespace DEMCR {
+constexpr inline std::uint32_t TRCENA = (1 << 24); /**< enable DWT and ITM */
+}  // namespace DEMCR
+}  // namespace libMcuHw::dcb
+#endif
@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file data watchpoint and trace functions, Cortex M3/M4/M7 only
+ */
+#ifndef DWT_LL_HPP
+#define DWT_LL_HPP
+namespace libMcuLL::dwt {
+namespace hardware = libMcuHw::dwt;
+template <libMcu::dwtBaseAddress const& dwtAddress_, libMcu::dcbBaseAddress const& dcbAddress_>
+struct dwt {
+  /**
+   * @brief get registers from peripheral
+   *
+   * @return return pointer to DWT registers
+   */
+  static hardware::dwt* dwtPeripheral() {
+    return reinterpret_cast<hardware::dwt*>(dwtAddress);
+  }
+  /**
+   * @brief get registers from peripheral
+   *
+   * @return return pointer to debug control block registers
+   */
+  static libMcuHw::dcb::dcb* dcbPeripheral() {
+    return reinterpret_cast<libMcuHw::dcb::dcb*>(dcbAddress);
+  }
+  /**
+   * @brief enable trace and start the cycle counter from zero
+   *
+   * @return ERROR when the core has no cycle counter, NO_ERROR otherwise
+   */
+  libMcu::results init() {
+    dcbPeripheral()->DEMCR = dcbPeripheral()->DEMCR | libMcuHw::dcb::DEMCR::TRCENA;
+    if (dwtPeripheral()->CTRL & hardware::CTRL::NOCYCCNT)
+      return libMcu::results::ERROR;
+    dwtPeripheral()->CYCCNT = 0;
+    dwtPeripheral()->CTRL = dwtPeripheral()->CTRL | hardware::CTRL::CYCCNTENA;
+    return libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief Get cycle counter value
+   *
+   * @return current cycle count
+   */
+  std::uint32_t getCount() {
+    return dwtPeripheral()->CYCCNT;
+  }
+  /**
+   * @brief cycles between two getCount values
+   *
+   * @param start count at the start of the interval
+   * @param end count at the end of the interval
+   * @return elapsed cycles, intervals up to 2^32 cycles
+   */
+  constexpr std::uint32_t getElapsed(std::uint32_t start, std::uint32_t end) {
+    return end - start;
+  }
+
+  static constexpr libMcu::hwAddressType dwtAddress = dwtAddress_; /**< peripheral address */
+  static constexpr libMcu::hwAddressType dcbAddress = dcbAddress_; /**< debug control block address */
+};
+}  // namespace libMcuLL::dwt
+#endif
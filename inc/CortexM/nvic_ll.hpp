@@ -134,6 +134,87 @@ struct nvic {
     }
   }
 
+  /**
+   * @brief enable multiple interrupts with a single register write
+   *
+   * @tparam t_interrupts device interrupts to enable
+   */
+  template <libMcuHw::interrupts... t_interrupts>
+  constexpr void enable() {
+    enableMask(getInterruptMask<t_interrupts...>());
+  }
+
+  /**
+   * @brief disable multiple interrupts with a single register write
+   *
+   * @tparam t_interrupts device interrupts to disable
+   */
+  template <libMcuHw::interrupts... t_interrupts>
+  constexpr void disable() {
+    disableMask(getInterruptMask<t_interrupts...>());
+  }
+
+  /**
+   * @brief enable all interrupts set in a mask
+   *
+   * @param mask interrupt mask, bit N enables interrupt N
+   */
+  constexpr void enableMask(std::uint32_t mask) {
+    nvicPeripheral()->ISER[0] = mask;
+  }
+
+  /**
+   * @brief disable all interrupts set in a mask
+   *
+   * @param mask interrupt mask, bit N disables interrupt N
+   */
+  constexpr void disableMask(std::uint32_t mask) {
+    nvicPeripheral()->ICER[0] = mask;
+    libMcuLL::dsb();
+    libMcuLL::isb();
+  }
+
+  /**
+   * @brief get the currently enabled interrupts, can be used to restore them with enableMask
+   *
+   * @return interrupt mask, bit N set when interrupt N is enabled
+   */
+  constexpr std::uint32_t getEnabledMask() {
+    return nvicPeripheral()->ISER[0];
+  }
+
+  /**
+   * @brief set the priority of multiple interrupts
+   *
+   * The priority fields are combined at compile time so every priority register is written at most once.
+   *
+   * @tparam t_priority priority level to set
+   * @tparam t_interrupts interrupts to set the priority of, system exceptions are allowed
+   */
+  template <std::uint32_t t_priority, libMcuHw::interrupts... t_interrupts>
+  constexpr void setPriority() {
+    static_assert(t_priority < (1u << hardware::priorityBits), "priority level out of range!");
+    constexpr priorityMasks masks = getPriorityMasks<t_priority, t_interrupts...>();
+    [&]<std::size_t... index>(std::index_sequence<index...>) {
+      (updatePriority<masks.nvicClear[index], masks.nvicSet[index]>(nvicPeripheral()->IP[index]), ...);
+    }(std::make_index_sequence<masks.nvicClear.size()>{});
+    [&]<std::size_t... index>(std::index_sequence<index...>) {
+      (updatePriority<masks.scbClear[index], masks.scbSet[index]>(scbPeripheral()->SHP[index]), ...);
+    }(std::make_index_sequence<masks.scbClear.size()>{});
+  }
+
+  /**
+   * @brief Compute the enable mask of a list of interrupts
+   *
+   * @tparam t_interrupts device interrupts, system exceptions are not allowed
+   * @return interrupt mask, bit N set for interrupt N
+   */
+  template <libMcuHw::interrupts... t_interrupts>
+  static consteval std::uint32_t getInterruptMask() {
+    static_assert(((static_cast<std::int32_t>(t_interrupts) >= 0) && ...), "only device interrupts can be masked!");
+    return ((1u << static_cast<std::uint32_t>(t_interrupts)) | ... | 0u);
+  }
+
   /**
    * @brief Extract the interrupt index register from interrupt value
    *
@@ -170,6 +251,58 @@ struct nvic {
     return static_cast<std::uint32_t>(interrupt) >> 2;
   }
 
+  /**
+   * @brief Priority register fields touched by a batch priority update
+   */
+  struct priorityMasks {
+    std::array<std::uint32_t, 8> nvicClear; /**< NVIC IP register bits to clear */
+    std::array<std::uint32_t, 8> nvicSet;   /**< NVIC IP register bits to set */
+    std::array<std::uint32_t, 2> scbClear;  /**< SCB SHP register bits to clear */
+    std::array<std::uint32_t, 2> scbSet;    /**< SCB SHP register bits to set */
+  };
+
+  /**
+   * @brief Compute the priority register fields for a list of interrupts
+   *
+   * @tparam t_priority priority level to set
+   * @tparam t_interrupts interrupts to set the priority of
+   * @return fields to clear and set per priority register
+   */
+  template <std::uint32_t t_priority, libMcuHw::interrupts... t_interrupts>
+  static consteval priorityMasks getPriorityMasks() {
+    priorityMasks masks{};
+    for (libMcuHw::interrupts interrupt : {t_interrupts...}) {
+      std::int32_t number = static_cast<std::int32_t>(interrupt);
+      bool isException = number < 0;
+      if (isException)
+        number = number + 8;  // same translation to SCB priority field index as setPriority
+      std::uint32_t index = static_cast<std::uint32_t>(number) >> 2;
+      std::uint32_t clear = hardware::IP::IPR(0u, static_cast<std::uint32_t>(number), (1u << hardware::priorityBits) - 1u);
+      std::uint32_t set = hardware::IP::IPR(0u, static_cast<std::uint32_t>(number), t_priority);
+      if (isException) {
+        masks.scbClear[index] |= clear;
+        masks.scbSet[index] = (masks.scbSet[index] & ~clear) | set;
+      } else {
+        masks.nvicClear[index] |= clear;
+        masks.nvicSet[index] = (masks.nvicSet[index] & ~clear) | set;
+      }
+    }
+    return masks;
+  }
+
+  /**
+   * @brief Update a priority register, registers without fields to change are not touched
+   *
+   * @tparam t_clear bits to clear
+   * @tparam t_set bits to set
+   * @param priorityRegister priority register to update
+   */
+  template <std::uint32_t t_clear, std::uint32_t t_set>
+  static constexpr void updatePriority(volatile std::uint32_t& priorityRegister) {
+    if constexpr (t_clear != 0)
+      priorityRegister = (priorityRegister & ~t_clear) | t_set;
+  }
+
   static constexpr libMcu::hwAddressType nvicAddress = nvicAddress_; /**< nvic peripheral address */
   static constexpr libMcu::hwAddressType scbAddress = scbAddress_;   /**< scb peripheral address */
 };
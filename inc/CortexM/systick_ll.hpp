@@ -54,6 +54,22 @@ struct systick {
     return systickPeripheral()->CVR;
   }
 
+  /**
+   * @brief cycles between two getCount values
+   *
+   * Handles a single reload between start and end, so intervals up to one reload period can be measured while the systick
+   * keeps running as periodic tick.
+   *
+   * @param start count at the start of the interval
+   * @param end count at the end of the interval
+   * @return elapsed systick cycles
+   */
+  constexpr std::uint32_t getElapsed(std::uint32_t start, std::uint32_t end) {
+    if (start >= end)
+      return start - end;
+    return start + (systickPeripheral()->RVR & hardware::RVR::RESERVED_MASK) + 1 - end;
+  }
+
   /**
    * @brief did the systick counter pass zero
    *
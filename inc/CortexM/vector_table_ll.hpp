@@ -0,0 +1,144 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file RAM vector table functions
+ */
+#ifndef VECTOR_TABLE_LL_HPP
+#define VECTOR_TABLE_LL_HPP
+namespace libMcuLL::vectorTable {
+constexpr inline std::size_t exceptionCount = 16; /**< amount of system exception vectors, including the initial stack pointer */
+
+/**
+ * @brief Convert an interrupt to its vector table index
+ *
+ * @param interrupt interrupt or system exception
+ * @return vector table index
+ */
+constexpr inline std::size_t getVectorIndex(libMcuHw::interrupts interrupt) {
+  return static_cast<std::size_t>(static_cast<std::int32_t>(interrupt) + static_cast<std::int32_t>(exceptionCount));
+}
+
+/**
+ * @brief Binding of the isr() method of an object to an interrupt
+ *
+ * The handler calls the method directly on the object, it is known at compile time so there is no pointer to load.
+ *
+ * @tparam t_interrupt interrupt or system exception to bind to
+ * @tparam t_object object with an isr() method, needs static storage duration
+ */
+template <libMcuHw::interrupts t_interrupt, auto& t_object>
+struct binding {
+  static constexpr libMcuHw::interrupts interrupt = t_interrupt; /**< bound interrupt */
+  /**
+   * @brief Interrupt handler placed in the vector table
+   */
+  static void handler() {
+    t_object.isr();
+  }
+};
+
+/**
+ * @brief Vector table layout as expected by the core
+ *
+ * @tparam t_interrupts amount of device interrupts
+ */
+template <std::size_t t_interrupts>
+struct staticVectors {
+  const void* stackPointer;                                                  /**< initial stack pointer */
+  std::array<libMcu::isrLambda, exceptionCount - 1 + t_interrupts> handlers; /**< reset, exception and interrupt handlers */
+};
+
+/**
+ * @brief Generate a vector table at compile time
+ *
+ * Place the result in the vector table section, for example:
+ * `[[gnu::section(".isr_vector"), gnu::used]] constexpr auto table = makeVectorTable<32, binding<interrupts::uart0, uart>>(...);`
+ *
+ * @tparam t_interrupts amount of device interrupts
+ * @tparam t_bindings list of binding types, interrupts without a binding get the default handler
+ * @param stackPointer initial stack pointer, usually the address of the stack top linker symbol
+ * @param resetHandler reset handler
+ * @param defaultHandler handler for all vectors without a binding
+ * @return complete vector table
+ */
+template <std::size_t t_interrupts, typename... t_bindings>
+consteval staticVectors<t_interrupts> makeVectorTable(const void* stackPointer, libMcu::isrLambda resetHandler,
+                                                      libMcu::isrLambda defaultHandler) {
+  static_assert(((getVectorIndex(t_bindings::interrupt) > 1) && ...), "the stack pointer and reset vector cannot be bound!");
+  static_assert(((getVectorIndex(t_bindings::interrupt) < exceptionCount + t_interrupts) && ...), "interrupt out of range!");
+  static_assert(!libMcu::hasDuplicates(std::array<std::size_t, sizeof...(t_bindings)>{getVectorIndex(t_bindings::interrupt)...}),
+                "an interrupt is bound more than once!");
+  staticVectors<t_interrupts> table{stackPointer, {}};
+  table.handlers.fill(defaultHandler);
+  table.handlers[0] = resetHandler;
+  ((table.handlers[getVectorIndex(t_bindings::interrupt) - 1] = &t_bindings::handler), ...);
+  return table;
+}
+
+/**
+ * @brief Vector table in RAM, handlers can be changed while running
+ *
+ * The table is aligned to what VTOR requires, place the instance in RAM. Handlers are stored as plain function addresses, HAL
+ * objects are bound through a per object function generated at compile time so no runtime trampoline or object pointer is
+ * needed.
+ *
+ * @tparam scbAddress_ SCB peripheral address
+ * @tparam t_interrupts amount of device interrupts
+ */
+template <libMcu::scbBaseAddress const& scbAddress_, std::size_t t_interrupts = 32>
+struct ramVectorTable : libMcu::peripheralBase {
+  /**
+   * @brief Copy the active vector table and relocate it to RAM
+   */
+  void init() {
+    const volatile std::uint32_t* activeTable = reinterpret_cast<const volatile std::uint32_t*>(scbLL.scbPeripheral()->VTOR);
+    for (std::size_t index = 0; index < vectors.size(); index++)
+      vectors[index] = activeTable[index];
+    libMcuLL::dsb();
+    scbLL.setVtor(vectors.data());
+    libMcuLL::dsb();
+    libMcuLL::isb();
+  }
+  /**
+   * @brief Bind a handler function to an interrupt
+   *
+   * @param interrupt interrupt or system exception to bind to
+   * @param handler handler function
+   */
+  void bind(libMcuHw::interrupts interrupt, libMcu::isrLambda handler) {
+    vectors[getVectorIndex(interrupt)] = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(handler));
+    libMcuLL::dsb();
+  }
+  /**
+   * @brief Bind the isr() method of a HAL or LL object to an interrupt
+   *
+   * @tparam t_interrupt interrupt or system exception to bind to
+   * @tparam t_object object with an isr() method, needs static storage duration
+   */
+  template <libMcuHw::interrupts t_interrupt, auto& t_object>
+  void bind() {
+    static_assert(static_cast<std::int32_t>(t_interrupt) + static_cast<std::int32_t>(exceptionCount) > 1,
+                  "the initial stack pointer and reset vector cannot be bound!");
+    static_assert(static_cast<std::int32_t>(t_interrupt) < static_cast<std::int32_t>(t_interrupts), "interrupt out of range!");
+    bind(t_interrupt, &binding<t_interrupt, t_object>::handler);
+  }
+  /**
+   * @brief Get the handler address bound to an interrupt
+   *
+   * @param interrupt interrupt or system exception
+   * @return handler address
+   */
+  std::uint32_t getHandler(libMcuHw::interrupts interrupt) {
+    return vectors[getVectorIndex(interrupt)];
+  }
+
+ private:
+  alignas(~libMcuHw::vtor::addressMask + 1u) std::array<std::uint32_t, exceptionCount + t_interrupts> vectors; /**< vectors */
+  libMcuLL::scb::scb<scbAddress_> scbLL;                                                                     /**< SCB */
+};
+}  // namespace libMcuLL::vectorTable
+#endif
@@ -38,26 +38,36 @@ struct mux3to8 {
   /**
    * @brief setup multiplexer
    *
+   * When all pins are on the same port and the gpio HAL supports masked port writes, the address and enable lines change
+   * in a single write so no intermediate address is ever visible on the outputs. Otherwise the pins are set one by one.
+   *
    * @param enable enable or disable
    * @param value which value to multiplex
    */
   void set(bool enable, std::uint32_t value) {
-    if (value & 0x01)
-      gpioHal.high(a0Pin);
-    else
-      gpioHal.low(a0Pin);
-    if (value & 0x02)
-      gpioHal.high(a1Pin);
-    else
-      gpioHal.low(a1Pin);
-    if (value & 0x04)
-      gpioHal.high(a2Pin);
-    else
-      gpioHal.low(a2Pin);
-    if (enable)
-      gpioHal.low(notEnablePin);
-    else
-      gpioHal.high(notEnablePin);
+    if constexpr (fastPath) {
+      std::uint32_t setting = addressPatterns[value & 0x07];
+      if (!enable)
+        setting = setting | notEnablePinType::pinMask;
+      gpioHal.portSetMasked(notEnablePin, portMask, setting);
+    } else {
+      if (value & 0x01)
+        gpioHal.high(a0Pin);
+      else
+        gpioHal.low(a0Pin);
+      if (value & 0x02)
+        gpioHal.high(a1Pin);
+      else
+        gpioHal.low(a1Pin);
+      if (value & 0x04)
+        gpioHal.high(a2Pin);
+      else
+        gpioHal.low(a2Pin);
+      if (enable)
+        gpioHal.low(notEnablePin);
+      else
+        gpioHal.high(notEnablePin);
+    }
   }
 
  private:
@@ -66,8 +76,68 @@ struct mux3to8 {
   static constexpr a1PinType a1Pin{};
   static constexpr a2PinType a2Pin{};
 
-  // add constraints here
   using halType = std::remove_reference<decltype(gpioHal)>::type;
+
+  /**
+   * @brief check if all pins have port traits and share the same port
+   *
+   * @return true if all pins are on one port
+   */
+  static consteval bool pinsOnSinglePort() {
+    if constexpr (requires {
+                    notEnablePinType::port;
+                    notEnablePinType::pinMask;
+                    a0PinType::port;
+                    a0PinType::pinMask;
+                    a1PinType::port;
+                    a1PinType::pinMask;
+                    a2PinType::port;
+                    a2PinType::pinMask;
+                  })
+      return (notEnablePinType::port == a0PinType::port) && (notEnablePinType::port == a1PinType::port) &&
+             (notEnablePinType::port == a2PinType::port);
+    else
+      return false;
+  }
+
+  /**
+   * @brief precompute the output patterns of the address pins for all multiplexer values
+   *
+   * @return table with address pin settings indexed by multiplexer value
+   */
+  static consteval std::array<std::uint32_t, 8> makeAddressPatterns() {
+    std::array<std::uint32_t, 8> patterns{};
+    if constexpr (pinsOnSinglePort()) {
+      for (std::uint32_t value = 0; value < patterns.size(); value++) {
+        if (value & 0x01)
+          patterns[value] = patterns[value] | a0PinType::pinMask;
+        if (value & 0x02)
+          patterns[value] = patterns[value] | a1PinType::pinMask;
+        if (value & 0x04)
+          patterns[value] = patterns[value] | a2PinType::pinMask;
+      }
+    }
+    return patterns;
+  }
+
+  /**
+   * @brief combined mask of all multiplexer pins
+   *
+   * @return port mask, zero if the pins do not share a port
+   */
+  static consteval std::uint32_t makePortMask() {
+    if constexpr (pinsOnSinglePort())
+      return notEnablePinType::pinMask | a0PinType::pinMask | a1PinType::pinMask | a2PinType::pinMask;
+    else
+      return 0;
+  }
+
+  static constexpr bool fastPath =
+    pinsOnSinglePort() && requires(halType &hal) { hal.portSetMasked(notEnablePin, 0u, 0u); }; /**< single write possible */
+  static constexpr std::array<std::uint32_t, 8> addressPatterns = makeAddressPatterns(); /**< address pin patterns */
+  static constexpr std::uint32_t portMask = makePortMask(); /**< mask of all multiplexer pins */
+
+  // add constraints here
   static_assert(std::is_base_of<libMcuHal::halGpioBase, halType>::value, "gpioPeripheral is not derived from halGpioBase");
   static_assert(std::is_base_of<libMcu::pinBase, notEnablePinType>::value, "notEnablePinType is not derived from pinBase");
   static_assert(std::is_base_of<libMcu::pinBase, a0PinType>::value, "a0PinType is not derived from pinBase");
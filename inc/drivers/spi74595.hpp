@@ -10,4 +10,250 @@
 #ifndef SPI74595_HPP
 #define SPI74595_HPP
 
-#endif
\ No newline at end of file
+namespace libMcuDriver::spi74595 {
+
+/**
+ * @brief Driver for a daisy chain of 74595 shift registers
+ *
+ * Keeps a shadow image of all chained registers, bits are changed in the image without bus traffic and sent out by flush or
+ * refresh. The latch input (RCLK) must be connected to the chip select of the SPI bus, the rising chip select edge at the end of
+ * a transfer updates all outputs at once.
+ *
+ * Register 0 is the register connected to the microcontroller, bit 0 of register 0 is output QA of that register. The image is
+ * kept in transmission order, so it can be handed to the SPI HAL (or its DMA) as is.
+ *
+ * When the SPI HAL offers startWrite/progressWrite (interrupt or DMA driven) transfers are started in the background, otherwise
+ * the blocking write method is used.
+ *
+ * @tparam &spiHal object reference to a SPI Hal object
+ * @tparam registerCount amount of chained 74595 registers
+ * @tparam frameCount amount of images to cycle through in refresh mode, use more then one for multiplexed displays
+ */
+template <auto &spiHal, std::size_t registerCount, std::size_t frameCount = 1>
+struct spi74595 {
+  /**
+   * @brief clear all images, the next flush or refresh will send them
+   */
+  void initialize() {
+    for (auto &frame : frames)
+      frame.fill(0u);
+    dirty = true;
+    currentFrame = 0;
+  }
+
+  /**
+   * @brief set a single output high
+   *
+   * @param bit output to set, bit 0 is QA of register 0
+   * @param frame image to change
+   */
+  void setBit(std::size_t bit, std::size_t frame = 0) {
+    frames[frame][byteIndex(bit)] = frames[frame][byteIndex(bit)] | bitMask(bit);
+    dirty = true;
+  }
+
+  /**
+   * @brief set a single output low
+   *
+   * @param bit output to clear, bit 0 is QA of register 0
+   * @param frame image to change
+   */
+  void clearBit(std::size_t bit, std::size_t frame = 0) {
+    frames[frame][byteIndex(bit)] = frames[frame][byteIndex(bit)] & ~bitMask(bit);
+    dirty = true;
+  }
+
+  /**
+   * @brief toggle a single output
+   *
+   * @param bit output to toggle, bit 0 is QA of register 0
+   * @param frame image to change
+   */
+  void toggleBit(std::size_t bit, std::size_t frame = 0) {
+    frames[frame][byteIndex(bit)] = frames[frame][byteIndex(bit)] ^ bitMask(bit);
+    dirty = true;
+  }
+
+  /**
+   * @brief get the state of an output in the image
+   *
+   * @param bit output to get, bit 0 is QA of register 0
+   * @param frame image to read
+   * @return true if the output is set in the image
+   */
+  bool getBit(std::size_t bit, std::size_t frame = 0) const {
+    return (frames[frame][byteIndex(bit)] & bitMask(bit)) != 0;
+  }
+
+  /**
+   * @brief set all outputs of a register
+   *
+   * @param index register index, register 0 is connected to the microcontroller
+   * @param value output value, bit 0 is output QA
+   * @param frame image to change
+   */
+  void setRegister(std::size_t index, std::uint8_t value, std::size_t frame = 0) {
+    frames[frame][registerCount - 1 - index] = value;
+    dirty = true;
+  }
+
+  /**
+   * @brief get all outputs of a register
+   *
+   * @param index register index, register 0 is connected to the microcontroller
+   * @param frame image to read
+   * @return output value, bit 0 is output QA
+   */
+  std::uint8_t getRegister(std::size_t index, std::size_t frame = 0) const {
+    return frames[frame][registerCount - 1 - index];
+  }
+
+  /**
+   * @brief send the image to the shift registers when it was changed
+   *
+   * Only usable when a single frame is used, multiplexed displays use refresh.
+   *
+   * @return DONE when nothing had to be sent or the blocking transfer is done
+   * @return STARTED when a background transfer has been started, call progress until it is DONE
+   * @return BUSY when a previous background transfer is still running
+   * @return ERROR when the background transfer could not be started, the image stays dirty
+   */
+  libMcu::results flush() {
+    static_assert(frameCount == 1, "flush is only usable with a single frame, use refresh instead!");
+    if (transferring)
+      return libMcu::results::BUSY;
+    if (!dirty)
+      return libMcu::results::DONE;
+    return send(0);
+  }
+
+  /**
+   * @brief send the next frame unconditionally
+   *
+   * Call this periodically, for example from a timer interrupt, to scan multiplexed displays or to periodically rewrite outputs
+   * that might get disturbed.
+   *
+   * @return DONE when the blocking transfer is done
+   * @return STARTED when a background transfer has been started
+   * @return BUSY when a previous background transfer is still running, the frame is not advanced
+   * @return ERROR when the background transfer could not be started, the frame is not advanced
+   */
+  libMcu::results refresh() {
+    if (transferring)
+      return libMcu::results::BUSY;
+    libMcu::results result = send(currentFrame);
+    if (result == libMcu::results::ERROR)
+      return result;
+    currentFrame++;
+    if (currentFrame == frameCount)
+      currentFrame = 0;
+    return result;
+  }
+
+  /**
+   * @brief progress a background transfer
+   *
+   * @return DONE when no transfer is running or it has completed
+   * @return BUSY when the transfer is still running
+   */
+  libMcu::results progress() {
+    if constexpr (asyncHal) {
+      if (!transferring)
+        return libMcu::results::DONE;
+      libMcu::results result = spiHal.progressWrite();
+      if (result == libMcu::results::BUSY)
+        return libMcu::results::BUSY;
+      transferring = false;
+    }
+    return libMcu::results::DONE;
+  }
+
+  /**
+   * @brief check if the image has changes that are not sent yet
+   *
+   * @return true if flush will send data
+   */
+  bool isDirty() const {
+    return dirty;
+  }
+
+  /**
+   * @brief get the frame that the next refresh will send
+   *
+   * @return frame index
+   */
+  std::size_t getCurrentFrame() const {
+    return currentFrame;
+  }
+
+ private:
+  using halType = std::remove_reference<decltype(spiHal)>::type;
+
+  /**
+   * @brief send a frame using the best method the HAL supports
+   *
+   * Background transfers send a copy of the frame, so the image can be changed while the transfer is running.
+   *
+   * @param frame frame to send
+   * @return DONE when the blocking transfer is done
+   * @return STARTED when a background transfer has been started
+   * @return ERROR when the HAL did not start the background transfer
+   */
+  libMcu::results send(std::size_t frame) {
+    dirty = false;
+    if constexpr (asyncHal) {
+      transmitBuffer = frames[frame];
+      transferring = true;
+      if (spiHal.startWrite(std::span<std::uint8_t>(transmitBuffer)) != libMcu::results::STARTED) {
+        transferring = false;
+        dirty = true;
+        return libMcu::results::ERROR;
+      }
+      return libMcu::results::STARTED;
+    } else {
+      spiHal.write(std::span<std::uint8_t>(frames[frame]));
+      return libMcu::results::DONE;
+    }
+  }
+
+  /**
+   * @brief get the image byte of an output
+   *
+   * @param bit output index
+   * @return index in the image
+   */
+  static constexpr std::size_t byteIndex(std::size_t bit) {
+    return registerCount - 1 - (bit >> 3);
+  }
+
+  /**
+   * @brief get the image bit mask of an output
+   *
+   * @param bit output index
+   * @return mask within the image byte
+   */
+  static constexpr std::uint8_t bitMask(std::size_t bit) {
+    return static_cast<std::uint8_t>(1u << (bit & 0x07));
+  }
+
+  static constexpr bool asyncHal = requires(halType &hal, std::span<std::uint8_t> buffer) {
+    hal.startWrite(buffer);
+    hal.progressWrite();
+  }; /**< HAL supports background transfers */
+
+  std::array<std::array<std::uint8_t, registerCount>, frameCount> frames{}; /**< shadow images in transmission order */
+  std::array<std::uint8_t, asyncHal ? registerCount : 0> transmitBuffer{};  /**< copy of the frame being transferred */
+  std::size_t currentFrame{0};                                              /**< next frame to refresh */
+  volatile bool dirty{true};                                                /**< image changed since last transfer */
+  volatile bool transferring{false};                                        /**< background transfer running */
+
+  // add constraints here
+  static_assert(std::is_base_of<libMcuHal::halSpiBase, halType>::value, "spiHal is not derived from halSpiBase");
+  static_assert(registerCount > 0, "at least one register is needed!");
+  static_assert(frameCount > 0, "at least one frame is needed!");
+  static_assert(asyncHal || requires(halType &hal, std::span<std::uint8_t> buffer) { hal.write(buffer); },
+                "spiHal does not provide a write method!");
+};
+}  // namespace libMcuDriver::spi74595
+
+#endif
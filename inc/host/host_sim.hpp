@@ -0,0 +1,243 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file host register simulation, runs unmodified LL code on a x86-64 Linux host
+ *
+ * Peripheral register blocks are mapped at their real addresses without access rights. Every register access of the LL code
+ * faults, the fault handler gives the attached peripheral model a chance to update the register before a read or react to
+ * the value after a write, and single steps the access. This keeps all LL code as is, only the device header and the models
+ * need to be included. The simulation is single threaded, only access the registers from the thread running the LL code.
+ *
+ * The compiler does not know that a register access runs the fault handler, it may keep model state in registers across
+ * the LL code. Every public model function is a compiler barrier for this, so only access model state through them and do
+ * not keep references returned by them across LL calls.
+ */
+#ifndef HOST_SIM_HPP
+#define HOST_SIM_HPP
+
+#if !(defined(__linux__) && defined(__x86_64__))
+#error "register simulation needs a x86-64 Linux host"
+#endif
+
+#include <atomic>
+#include <csignal>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "../libmcu/libmcu.hpp"
+
+namespace libMcuSim {
+/**
+ * @brief base of all peripheral models
+ *
+ * Models only touch their registers from within the access hooks, outside of the hooks the registers are not accessible.
+ */
+struct peripheralModel {
+  peripheralModel() = default;
+  virtual ~peripheralModel() = default;
+  peripheralModel(const peripheralModel&) = delete;
+  peripheralModel& operator=(const peripheralModel&) = delete;
+  /**
+   * @brief called before the LL code reads a register
+   * @param offset register offset in bytes from the peripheral base address
+   */
+  virtual void beforeRead([[maybe_unused]] std::uint32_t offset) {}
+  /**
+   * @brief called after the LL code has read a register
+   * @param offset register offset in bytes from the peripheral base address
+   */
+  virtual void afterRead([[maybe_unused]] std::uint32_t offset) {}
+  /**
+   * @brief called after the LL code has written a register
+   *
+   * Read modify write instructions only report the write.
+   * @param offset register offset in bytes from the peripheral base address
+   */
+  virtual void afterWrite([[maybe_unused]] std::uint32_t offset) {}
+  /**
+   * @brief amount of register reads done by the LL code
+   * @return read count
+   */
+  std::uint32_t getReads() const {
+    synchronize();
+    return reads;
+  }
+  /**
+   * @brief amount of register writes done by the LL code
+   * @return write count
+   */
+  std::uint32_t getWrites() const {
+    synchronize();
+    return writes;
+  }
+  /**
+   * @brief clear the access counters, use around a LL call to measure its register traffic
+   */
+  void resetCounters() {
+    synchronize();
+    reads = 0;
+    writes = 0;
+    synchronize();
+  }
+  /**
+   * @brief compiler barrier between the LL code and model state changed by the fault handler
+   *
+   * Every public model function calls it before using state the hooks use and again after changing it. Call it after
+   * changing model state through a returned reference, before the next LL call.
+   */
+  static void synchronize() {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+  }
+
+ protected:
+  /**
+   * @brief get a register value, only usable from the access hooks
+   * @param offset register offset in bytes
+   * @return register value
+   */
+  std::uint32_t getRegister(std::uint32_t offset) const {
+    return *reinterpret_cast<volatile std::uint32_t*>(static_cast<std::uintptr_t>(address + offset));
+  }
+  /**
+   * @brief set a register value, only usable from the access hooks
+   * @param offset register offset in bytes
+   * @param value new register value
+   */
+  void setRegister(std::uint32_t offset, std::uint32_t value) {
+    *reinterpret_cast<volatile std::uint32_t*>(static_cast<std::uintptr_t>(address + offset)) = value;
+  }
+
+ private:
+  friend libMcu::results attach(peripheralModel& model, libMcu::hwAddressType address, std::size_t size);
+  friend struct detail;
+  libMcu::hwAddressType address{0}; /**< peripheral base address */
+  std::size_t size{0};              /**< size of the register block */
+  std::uint32_t reads{0};           /**< register reads */
+  std::uint32_t writes{0};          /**< register writes */
+};
+
+/**
+ * @brief fault handling shared by all models
+ */
+struct detail {
+  static constexpr std::size_t maxModels = 32;                    /**< maximum amount of attached models */
+  static constexpr std::uint64_t trapFlag = 1u << 8;              /**< x86 single step flag */
+  static inline std::array<peripheralModel*, maxModels> models{}; /**< attached models */
+  static inline std::size_t modelCount{0};                        /**< amount of attached models */
+  static inline peripheralModel* pendingModel{nullptr};           /**< model of the access being single stepped */
+  static inline std::uint32_t pendingOffset{0};                   /**< register offset of the pending access */
+  static inline bool pendingWrite{false};                         /**< pending access is a write */
+  static inline std::uintptr_t pendingPage{0};                    /**< page of the pending access */
+
+  static std::uintptr_t pageSize() {
+    return static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  }
+  static peripheralModel* find(std::uintptr_t address) {
+    for (std::size_t index = 0; index < modelCount; index++) {
+      peripheralModel* model = models[index];
+      if ((address >= model->address) && (address < model->address + model->size))
+        return model;
+    }
+    return nullptr;
+  }
+  static bool pageInUse(std::uintptr_t page) {
+    for (std::size_t index = 0; index < modelCount; index++) {
+      std::uintptr_t first = models[index]->address & ~(pageSize() - 1);
+      std::uintptr_t last = (models[index]->address + models[index]->size - 1) & ~(pageSize() - 1);
+      if ((page >= first) && (page <= last))
+        return true;
+    }
+    return false;
+  }
+  static void faultHandler([[maybe_unused]] int signal, siginfo_t* info, void* context) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(info->si_addr);
+    peripheralModel* model = find(address);
+    if (model == nullptr) {
+      // not ours, let the retried access crash the normal way
+      std::signal(SIGSEGV, SIG_DFL);
+      return;
+    }
+    ucontext_t* userContext = static_cast<ucontext_t*>(context);
+    pendingModel = model;
+    pendingOffset = static_cast<std::uint32_t>(address - model->address);
+    pendingWrite = (userContext->uc_mcontext.gregs[REG_ERR] & 0x2) != 0;
+    pendingPage = address & ~(pageSize() - 1);
+    mprotect(reinterpret_cast<void*>(pendingPage), pageSize(), PROT_READ | PROT_WRITE);
+    if (pendingWrite) {
+      model->writes++;
+    } else {
+      model->reads++;
+      model->beforeRead(pendingOffset);
+    }
+    userContext->uc_mcontext.gregs[REG_EFL] |= trapFlag;
+  }
+  static void stepHandler([[maybe_unused]] int signal, [[maybe_unused]] siginfo_t* info, void* context) {
+    if (pendingModel == nullptr) {
+      std::signal(SIGTRAP, SIG_DFL);
+      return;
+    }
+    ucontext_t* userContext = static_cast<ucontext_t*>(context);
+    userContext->uc_mcontext.gregs[REG_EFL] &= ~trapFlag;
+    peripheralModel* model = pendingModel;
+    pendingModel = nullptr;
+    if (pendingWrite)
+      model->afterWrite(pendingOffset);
+    else
+      model->afterRead(pendingOffset);
+    mprotect(reinterpret_cast<void*>(pendingPage), pageSize(), PROT_NONE);
+  }
+  static bool installHandlers() {
+    struct sigaction action {};
+    action.sa_sigaction = faultHandler;
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGSEGV, &action, nullptr) != 0)
+      return false;
+    action.sa_sigaction = stepHandler;
+    return sigaction(SIGTRAP, &action, nullptr) == 0;
+  }
+};
+
+/**
+ * @brief map a register block at its real address and attach a model to it
+ *
+ * Register blocks sharing a page are allowed, overlapping register blocks are not.
+ *
+ * @param model model to call on register accesses
+ * @param address peripheral base address
+ * @param size size of the register block in bytes
+ * @return NO_ERROR when attached
+ * @return ERROR when no models can be added or the address range is used by the host
+ */
+inline libMcu::results attach(peripheralModel& model, libMcu::hwAddressType address, std::size_t size) {
+  if (detail::modelCount == detail::maxModels)
+    return libMcu::results::ERROR;
+  if ((detail::modelCount == 0) && !detail::installHandlers())
+    return libMcu::results::ERROR;
+  std::uintptr_t pageMask = detail::pageSize() - 1;
+  std::uintptr_t first = address & ~pageMask;
+  std::uintptr_t last = (address + size - 1) & ~pageMask;
+  for (std::uintptr_t page = first; page <= last; page = page + detail::pageSize()) {
+    if (detail::pageInUse(page))
+      continue;
+    void* mapping = mmap(reinterpret_cast<void*>(page), detail::pageSize(), PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (mapping != reinterpret_cast<void*>(page)) {
+      if (mapping != MAP_FAILED)
+        munmap(mapping, detail::pageSize());
+      return libMcu::results::ERROR;
+    }
+  }
+  model.address = address;
+  model.size = size;
+  detail::models[detail::modelCount] = &model;
+  detail::modelCount++;
+  return libMcu::results::NO_ERROR;
+}
+}  // namespace libMcuSim
+
+#endif
@@ -17,6 +17,7 @@
 #include <span>
 #include <type_traits>
 #include <limits>
+#include <utility>
 #include "libmcu_results.hpp"
 #include "libmcu_types.hpp"
 #include "libmcu_functions.hpp"
@@ -24,5 +25,6 @@
 #include "ringbuffer.hpp"
 #include "libmcuhal_types.hpp"
 #include "libmcu_algorithms.hpp"
+#include "profiler.hpp"
 
 #endif
\ No newline at end of file
@@ -13,26 +13,21 @@
 
 namespace libMcu {
 /**
- * @brief Finds Least common multiple of two values ranged by a maximum
- * @param a first value
- * @param b second value
- * @param max maximum to search until
- * @return least common multiple, returns zero if no value found
+ * @brief Check if a value occurs more than once in an array
+ * @tparam T value type
+ * @tparam N amount of values
+ * @param values values to check
+ * @return true when a value occurs more than once
  */
-consteval std::uint32_t findLcm(std::uint32_t a, std::uint32_t b, std::uint32_t max) {
-  std::uint32_t aSum = a;
-  std::uint32_t bSum = b;
-  while (aSum != bSum) {
-    if (aSum < bSum)
-      aSum = aSum + a;
-    else
-      bSum = bSum + b;
-    if (aSum > (max - a))
-      return 0;
-    if (bSum > (max - b))
-      return 0;
+template <typename T, std::size_t N>
+consteval bool hasDuplicates(const std::array<T, N> &values) {
+  for (std::size_t first = 0; first < N; first++) {
+    for (std::size_t second = first + 1; second < N; second++) {
+      if (values[first] == values[second])
+        return true;
+    }
   }
-  return aSum;
+  return false;
 }
 }  // namespace libMcu
 
@@ -19,6 +19,15 @@ inline void delay(std::uint32_t cycles) {
     "bne 1b"
     : "+r"(cycles));
 }
+
+/**
+ * @brief Get the 32 bit bus address of an object, for address registers and DMA or ROM parameters
+ * @param object object to get the address of
+ * @return bus address
+ */
+inline std::uint32_t getAddress(const volatile void *object) {
+  return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(object));
+}
 }  // namespace libMcuLL
 
 #endif
\ No newline at end of file
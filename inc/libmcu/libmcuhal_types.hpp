@@ -27,6 +27,7 @@ struct halBase {
 };
 /* Hal base classes */
 struct halGpioBase : halBase {};
+struct halSpiBase : halBase {};
 }  // namespace libMcuHal
 
 #endif
\ No newline at end of file
@@ -39,6 +39,8 @@ struct nvicBaseAddress : hwAddressBase {};    /**< NVIC */
 struct scbBaseAddress : hwAddressBase {};     /**< SCB */
 struct mpuBaseAddress : hwAddressBase {};     /**< MPU */
 struct mtbBaseAddress : hwAddressBase {};     /**< MTB */
+struct dwtBaseAddress : hwAddressBase {};     /**< DWT */
+struct dcbBaseAddress : hwAddressBase {};     /**< Debug control block */
 
 /* Peripheral address types used by all microcontrollers */
 struct i2cBaseAddress : hwAddressBase {};  /**< I2C */
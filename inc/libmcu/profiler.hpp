@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file cycle count profiling of code zones
+ */
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+namespace libMcu::profiler {
+/**
+ * @brief aggregated measurements of a single zone
+ */
+struct statistics {
+  std::uint32_t count;   /**< amount of measurements */
+  std::uint32_t minimum; /**< smallest measurement in cycles */
+  std::uint32_t maximum; /**< largest measurement in cycles */
+  std::uint64_t total;   /**< sum of all measurements in cycles */
+  /**
+   * @brief mean of all measurements
+   * @return mean in cycles, 0 when nothing is measured
+   */
+  constexpr std::uint32_t mean() const {
+    if (count == 0)
+      return 0;
+    return static_cast<std::uint32_t>(total / count);
+  }
+};
+
+/**
+ * @brief Profiler that aggregates cycle counts of numbered zones into a fixed table
+ *
+ * The counter is any peripheral providing getCount and getElapsed, like libMcuLL::systick (all cores, counts processor clocks
+ * when started with the processor clock source) or libMcuLL::dwt (Cortex M3/M4/M7 cycle counter). Start and configure the counter
+ * before profiling. When enabled is false the table has no storage and all calls compile to nothing, so instrumentation can stay
+ * in the code.
+ *
+ * @tparam counter reference to a counter peripheral instance
+ * @tparam zoneCount amount of zones in the table
+ * @tparam enabled set to false to remove all instrumentation
+ */
+template <auto &counter, std::size_t zoneCount, bool enabled = true>
+struct profiler {
+  /**
+   * @brief RAII timer, measures from construction until it goes out of scope
+   */
+  struct scopedZone {
+    /**
+     * @brief start measuring a zone
+     * @param owner profiler to record to
+     * @param zone zone index
+     */
+    scopedZone(profiler &owner, std::size_t zone) : owner{owner}, zone{zone} {
+      if constexpr (enabled)
+        start = counter.getCount();
+    }
+    ~scopedZone() {
+      if constexpr (enabled)
+        owner.record(zone, counter.getElapsed(start, counter.getCount()));
+    }
+    scopedZone(const scopedZone &) = delete;
+    scopedZone &operator=(const scopedZone &) = delete;
+
+   private:
+    profiler &owner;        /**< profiler to record to */
+    std::size_t zone;       /**< zone index */
+    std::uint32_t start{0}; /**< counter value at construction */
+  };
+  /**
+   * @brief Construct a new profiler with all zones cleared
+   */
+  constexpr profiler() {
+    reset();
+  }
+  /**
+   * @brief clear all zones
+   */
+  constexpr void reset() {
+    if constexpr (enabled) {
+      for (statistics &entry : table)
+        entry = {0, std::numeric_limits<std::uint32_t>::max(), 0, 0};
+    }
+  }
+  /**
+   * @brief measure a zone until the returned object goes out of scope
+   *
+   * Usage: auto measurement = profile.measure(3);
+   *
+   * @param zone zone index
+   * @return scoped measurement
+   */
+  [[nodiscard]] scopedZone measure(std::size_t zone) {
+    return scopedZone{*this, zone};
+  }
+  /**
+   * @brief add a measurement to a zone
+   * @param zone zone index
+   * @param cycles measured cycles
+   */
+  constexpr void record(std::size_t zone, std::uint32_t cycles) {
+    if constexpr (enabled) {
+      statistics &entry = table[zone];
+      entry.count++;
+      entry.total = entry.total + cycles;
+      if (cycles < entry.minimum)
+        entry.minimum = cycles;
+      if (cycles > entry.maximum)
+        entry.maximum = cycles;
+    }
+  }
+  /**
+   * @brief get the measurements of a zone
+   * @param zone zone index
+   * @return aggregated measurements
+   */
+  constexpr statistics getZone(std::size_t zone) const {
+    if constexpr (enabled)
+      return table[zone];
+    else
+      return {0, 0, 0, 0};
+  }
+  /**
+   * @brief write the table as text, one "zone count min max mean" line per measured zone
+   *
+   * Works with any interface that can write a single character, like the synchronous UART HALs.
+   *
+   * @tparam T interface type
+   * @param interface interface to write to
+   */
+  template <typename T>
+  void dump(T &interface) const {
+    if constexpr (enabled) {
+      for (std::size_t zone = 0; zone < zoneCount; zone++) {
+        const statistics &entry = table[zone];
+        if (entry.count == 0)
+          continue;
+        writeNumber(interface, static_cast<std::uint32_t>(zone));
+        interface.write(' ');
+        writeNumber(interface, entry.count);
+        interface.write(' ');
+        writeNumber(interface, entry.minimum);
+        interface.write(' ');
+        writeNumber(interface, entry.maximum);
+        interface.write(' ');
+        writeNumber(interface, entry.mean());
+        interface.write('\r');
+        interface.write('\n');
+      }
+    }
+  }
+
+ private:
+  /**
+   * @brief write a decimal number
+   * @tparam T interface type
+   * @param interface interface to write to
+   * @param value number to write
+   */
+  template <typename T>
+  static void writeNumber(T &interface, std::uint32_t value) {
+    std::array<char, 10> digits;
+    std::size_t length = 0;
+    do {
+      digits[length] = static_cast<char>('0' + (value % 10));
+      value = value / 10;
+      length++;
+    } while (value != 0);
+    while (length > 0) {
+      length--;
+      interface.write(digits[length]);
+    }
+  }
+
+  std::array<statistics, enabled ? zoneCount : 0> table{}; /**< measurements per zone */
+
+  static_assert(zoneCount > 0, "profiler needs at least one zone!");
+};
+}  // namespace libMcu::profiler
+
+#endif
@@ -53,39 +53,100 @@ enum class periSource : std::uint8_t {
 };
 /**
  * @brief Microcontroller clock configuration generation
+ *
+ * Fails to compile when no PLL and divider setting reaches the system frequency within the allowed error.
+ *
  * @tparam t_source primary microcontroller clock source
  * @tparam t_inputFreq input frequency of this clock source
  * @tparam t_systemFreq wanted system (CPU) frequency
+ * @tparam t_maxError largest acceptable system frequency error in Hz, default is exact
  */
-template <clockInputSources t_source, std::uint32_t t_inputFreq, std::uint32_t t_systemFreq>
+template <clockInputSources t_source, std::uint32_t t_inputFreq, std::uint32_t t_systemFreq, std::uint32_t t_maxError = 0>
 struct mcuClockConfig {
-  static_assert(findClockFrequency(t_inputFreq, t_systemFreq) != 0, "Unable to find a clock configuration solution");
-  static constexpr clockInputSources source{t_source};
-  static constexpr std::uint32_t inputFreq{t_inputFreq};
-  static constexpr std::uint32_t mainFreq{findClockFrequency(t_inputFreq, t_systemFreq)};
-  static constexpr std::uint32_t systemFreq{t_systemFreq};
-  static constexpr std::uint32_t froFreq{froDefaultClockFreq};
+  static constexpr clockSettings settings{findClockSettings(t_inputFreq, t_systemFreq, t_maxError)}; /**< search result */
+  static_assert(settings.ahbDiv != 0, "Unable to find a clock configuration solution");
+  static constexpr clockInputSources source{t_source};                               /**< main clock source */
+  static constexpr std::uint32_t inputFreq{t_inputFreq};                             /**< main clock source frequency */
+  static constexpr std::uint32_t targetFreq{t_systemFreq};                           /**< requested system frequency */
+  static constexpr bool pllUsed{settings.pllUsed};                                   /**< main clock from system PLL */
+  static constexpr std::uint32_t msel{settings.msel};                                /**< PLL feedback divider setting */
+  static constexpr std::uint32_t psel{settings.psel};                                /**< PLL post divider setting */
+  static constexpr std::uint32_t ahbDiv{settings.ahbDiv};                            /**< system clock divider */
+  static constexpr std::uint32_t vcoFreq{settings.vcoFreq};                          /**< PLL oscillator frequency */
+  static constexpr std::uint32_t pllFreq{settings.pllUsed ? settings.mainFreq : 0u}; /**< PLL output frequency */
+  static constexpr std::uint32_t mainFreq{settings.mainFreq};                        /**< main clock frequency */
+  static constexpr std::uint32_t systemFreq{settings.systemFreq};                    /**< achieved system frequency */
+  static constexpr std::uint32_t froFreq{froDefaultClockFreq};                       /**< FRO frequency */
+  static constexpr bool exact{settings.error == 0};                                  /**< system frequency matches exactly */
   // TODO fractional rate converters?
 };
 /**
  * @brief peripheral clock configuration generation
+ *
+ * Peripherals clocked from the same fractional generator share its multiplier and source, configuring them with different
+ * settings overrides the generator for all of them.
+ *
  * @tparam &t_clockConfig microcontroller clock configuration
  * @tparam t_peripheral peripheral to configure
  * @tparam t_source clock source to setup
+ * @tparam t_frgMult fractional generator multiplier when t_source is FRG0 or FRG1, see findUsartFrgMult
+ * @tparam t_frgSource fractional generator clock source when t_source is FRG0 or FRG1
  */
-template <const mcuClockConfig &t_clockConfig, periSelect t_peripheral, periSource t_source>
+template <const mcuClockConfig &t_clockConfig, periSelect t_peripheral, periSource t_source, std::uint32_t t_frgMult = 0,
+          periSource t_frgSource = periSource::MAIN>
 struct periClockConfig {
+  static_assert(t_frgMult <= frgMaxMult, "Fractional generator multiplier out of range!");
   periSelect peripheral{t_peripheral};
   periSource source{t_source};
+  std::uint32_t frgMult{t_frgMult};
+  periSource frgSource{t_frgSource};
+  /**
+   * @brief get the fractional generator input frequency
+   * @return frequency before the fractional generator
+   */
+  static consteval std::uint32_t getFrgInputFrequency() {
+    if constexpr (t_frgSource == periSource::FRO)
+      return t_clockConfig.froFreq;
+    else if constexpr (t_frgSource == periSource::MAIN)
+      return t_clockConfig.mainFreq;
+    else if constexpr (t_frgSource == periSource::SYS_PLL) {
+      static_assert(t_clockConfig.pllUsed, "System PLL is not running in this clock configuration!");
+      return t_clockConfig.pllFreq;
+    } else
+      static_assert(false, "Unsupported clock input for the fractional generator!");
+    return 0;
+  }
+  /**
+   * @brief get the peripheral clock frequency before the fractional generator
+   * @return fractional generator input frequency for FRG sources, peripheral frequency otherwise
+   */
+  static consteval std::uint32_t getBaseFrequency() {
+    if constexpr (t_source == periSource::FRG0 || t_source == periSource::FRG1)
+      return getFrgInputFrequency();
+    else
+      return getFrequency();
+  }
+  /**
+   * @brief get the fractional generator multiplier applied to the base frequency
+   * @return multiplier for FRG sources, zero otherwise
+   */
+  static consteval std::uint32_t getFrgMult() {
+    if constexpr (t_source == periSource::FRG0 || t_source == periSource::FRG1)
+      return t_frgMult;
+    else
+      return 0;
+  }
+  /**
+   * @brief get the peripheral clock frequency
+   * @return peripheral clock frequency, rounded down
+   */
   static consteval std::uint32_t getFrequency() {
     if constexpr (t_source == periSource::FRO)
       return t_clockConfig.froFreq;
     else if constexpr (t_source == periSource::MAIN)
       return t_clockConfig.mainFreq;
-    else if constexpr (t_source == periSource::FRG0)
-      static_assert(false, "FRG0 input not implemented yet!");
-    else if constexpr (t_source == periSource::FRG1)
-      static_assert(false, "FRG1 input not implemented yet!");
+    else if constexpr (t_source == periSource::FRG0 || t_source == periSource::FRG1)
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(getFrgInputFrequency()) * 256u / (256u + t_frgMult));
     else if constexpr (t_source == periSource::FRO_DIV)
       static_assert(false, "FRO divider input not implemented yet!");
     else
@@ -6,7 +6,7 @@
  */
 /**
  * \file LPC8XX_clock.hpp
- * \brief TODO
+ * \brief LPC800 series compile time clock calculations
  */
 #ifndef LPC8XX_CLOCK_HPP
 #define LPC8XX_CLOCK_HPP
@@ -18,23 +18,167 @@ constexpr inline std::uint32_t systemPllMaxVcoFreq{320'000'000}; /**< maximum PL
 constexpr inline std::uint32_t mainClockMaxFreq{100'000'000};    /**< main clock max frequency */
 constexpr inline std::uint32_t froDefaultClockFreq{12'000'000};  /**< IRC clock frequency */
 
-consteval std::uint32_t findSystemPllPsel(uint32_t outFreq) {
-  if (outFreq > (systemPllMinVcoFreq >> 1U))
-    return libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV2;
-  else if (outFreq > (systemPllMinVcoFreq >> 2U))
-    return libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV4;
-  else if (outFreq > (systemPllMinVcoFreq >> 3U))
-    return libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV8;
-  else
-    return libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV16;
+constexpr inline std::uint32_t systemPllMinInputFreq{10'000'000}; /**< minimum PLL input frequency */
+constexpr inline std::uint32_t systemPllMaxInputFreq{25'000'000}; /**< maximum PLL input frequency */
+constexpr inline std::uint32_t systemPllMaxMsel{31};              /**< largest feedback divider setting, multiply by 32 */
+constexpr inline std::uint32_t systemClockMaxDiv{255};            /**< largest SYSAHBCLKDIV setting */
+
+/**
+ * @brief System PLL and system clock divider settings
+ */
+struct clockSettings {
+  bool pllUsed;             /**< main clock is taken from the system PLL */
+  std::uint32_t msel;       /**< PLL feedback divider setting, multiply by msel + 1 */
+  std::uint32_t psel;       /**< PLL post divider, formatted SYSPLLCTRL PSEL field */
+  std::uint32_t ahbDiv;     /**< system clock divider, zero when no solution was found */
+  std::uint32_t vcoFreq;    /**< PLL current controlled oscillator frequency, zero when PLL is not used */
+  std::uint32_t mainFreq;   /**< main clock frequency */
+  std::uint32_t systemFreq; /**< system clock frequency, rounded down */
+  std::uint32_t error;      /**< absolute difference between requested and system frequency, rounded up */
+};
+
+/**
+ * @brief Search all PLL and system clock divider settings for a system frequency
+ *
+ * Candidates are the input clock directly and every legal MSEL/PSEL combination, each with the best SYSAHBCLKDIV. The
+ * closest system frequency wins, ties are broken by lowest power: the PLL bypass first, then the lowest main clock and the
+ * lowest oscillator frequency.
+ *
+ * @param inputFreq main clock source frequency
+ * @param systemFreq wanted system (CPU) frequency
+ * @param maxError largest acceptable error in Hz
+ * @return clock settings, ahbDiv is zero when no setting is within maxError
+ */
+consteval clockSettings findClockSettings(std::uint32_t inputFreq, std::uint32_t systemFreq, std::uint32_t maxError) {
+  clockSettings best{false, 0, 0, 0, 0, 0, 0, 0};
+  // errors are compared as error * divider fractions to stay exact
+  std::uint64_t bestErrorScaled = 0;
+  std::uint64_t bestDiv = 1;
+  auto evaluate = [&](bool pllUsed, std::uint32_t msel, std::uint32_t psel, std::uint64_t vcoFreq, std::uint64_t mainFreq) {
+    if (mainFreq > mainClockMaxFreq || systemFreq == 0)
+      return;
+    std::uint64_t div = mainFreq / systemFreq;
+    // the nearest divider is either the rounded down or the rounded up quotient
+    for (std::uint64_t candidate = div; candidate <= div + 1; candidate++) {
+      if (candidate < 1 || candidate > systemClockMaxDiv)
+        continue;
+      std::uint64_t wanted = static_cast<std::uint64_t>(systemFreq) * candidate;
+      std::uint64_t errorScaled = mainFreq > wanted ? mainFreq - wanted : wanted - mainFreq;
+      if (errorScaled > static_cast<std::uint64_t>(maxError) * candidate)
+        continue;
+      bool better = best.ahbDiv == 0;
+      if (!better) {
+        std::uint64_t lhs = errorScaled * bestDiv;
+        std::uint64_t rhs = bestErrorScaled * candidate;
+        if (lhs < rhs)
+          better = true;
+        else if (lhs == rhs) {
+          if (pllUsed != best.pllUsed)
+            better = !pllUsed;
+          else if (mainFreq != best.mainFreq)
+            better = mainFreq < best.mainFreq;
+          else
+            better = vcoFreq < best.vcoFreq;
+        }
+      }
+      if (better) {
+        bestErrorScaled = errorScaled;
+        bestDiv = candidate;
+        best = {pllUsed,
+                msel,
+                psel,
+                static_cast<std::uint32_t>(candidate),
+                static_cast<std::uint32_t>(vcoFreq),
+                static_cast<std::uint32_t>(mainFreq),
+                static_cast<std::uint32_t>(mainFreq / candidate),
+                static_cast<std::uint32_t>((errorScaled + candidate - 1) / candidate)};
+      }
+    }
+  };
+  evaluate(false, 0, 0, 0, inputFreq);
+  if (inputFreq < systemPllMinInputFreq || inputFreq > systemPllMaxInputFreq)
+    return best;
+  constexpr std::uint32_t postDividers[] = {libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV2, libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV4,
+                                            libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV8, libMcuHw::syscon::SYSPLLCTRL::PSEL_DIV16};
+  for (std::uint32_t msel = 0; msel <= systemPllMaxMsel; msel++) {
+    std::uint64_t mainFreq = static_cast<std::uint64_t>(inputFreq) * (msel + 1);
+    // the current controlled oscillator runs at 2 * P times the output, P being 1, 2, 4 or 8
+    for (std::uint32_t p = 0; p < 4; p++) {
+      std::uint64_t vcoFreq = mainFreq * (2u << p);
+      if (vcoFreq >= systemPllMinVcoFreq && vcoFreq <= systemPllMaxVcoFreq)
+        evaluate(true, msel, postDividers[p], vcoFreq, mainFreq);
+    }
+  }
+  return best;
 }
 
-consteval uint32_t findSystemPllMsel(uint32_t inFreq, uint32_t outFreq) {
-  return (outFreq / inFreq) - 1;
+constexpr inline std::uint32_t frgMaxMult{255};     /**< largest fractional generator multiplier, denominator is 256 */
+constexpr inline std::uint32_t usartMinOsr{5};      /**< minimum USART oversampling */
+constexpr inline std::uint32_t usartMaxOsr{16};     /**< maximum USART oversampling */
+constexpr inline std::uint32_t usartMaxBrg{65'536}; /**< maximum USART baud rate divider */
+
+/**
+ * @brief USART fractional generator, oversampling and baud rate divider settings
+ */
+struct usartBaudSettings {
+  std::uint32_t frgMult;  /**< fractional generator multiplier */
+  std::uint32_t osr;      /**< oversampling, clocks per bit */
+  std::uint32_t brg;      /**< baud rate divider, zero when no solution was found */
+  std::uint32_t baudRate; /**< achieved baud rate, rounded down */
+  std::uint32_t error;    /**< absolute difference between requested and achieved baud rate in mHz, rounded up */
+};
+
+/**
+ * @brief Search fractional generator, oversampling and baud rate divider settings for a baud rate
+ *
+ * The baud rate is inputFreq / ((1 + frgMult / 256) * osr * brg). The closest baud rate wins, ties are broken by the highest
+ * oversampling for better noise immunity and then by the smallest multiplier.
+ *
+ * @param inputFreq clock frequency before the fractional generator
+ * @param baudRate wanted baud rate
+ * @param minFrgMult smallest multiplier to try, use zero when the USART is not clocked from a fractional generator
+ * @param maxFrgMult largest multiplier to try, use zero when the USART is not clocked from a fractional generator
+ * @param maxError largest acceptable baud rate error in Hz
+ * @return baud rate settings, brg is zero when no setting is within maxError
+ */
+consteval usartBaudSettings findUsartBaudSettings(std::uint32_t inputFreq, std::uint32_t baudRate, std::uint32_t minFrgMult,
+                                                  std::uint32_t maxFrgMult, std::uint32_t maxError) {
+  usartBaudSettings best{0, 0, 0, 0, 0};
+  if (baudRate == 0 || maxFrgMult > frgMaxMult)
+    return best;
+  // the fractional generator divides by (256 + mult) / 256, scaling the input by 256 keeps all calculations integer
+  std::uint64_t scaledFreq = static_cast<std::uint64_t>(inputFreq) * 256u;
+  for (std::uint32_t osr = usartMaxOsr; osr >= usartMinOsr; osr--) {
+    for (std::uint32_t mult = minFrgMult; mult <= maxFrgMult; mult++) {
+      std::uint64_t clocksPerBit = static_cast<std::uint64_t>(256u + mult) * osr;
+      std::uint64_t brg = scaledFreq / (clocksPerBit * baudRate);
+      // the nearest divider is either the rounded down or the rounded up quotient
+      for (std::uint64_t candidate = brg; candidate <= brg + 1; candidate++) {
+        if (candidate < 1 || candidate > usartMaxBrg)
+          continue;
+        std::uint64_t divider = clocksPerBit * candidate;
+        std::uint64_t wanted = static_cast<std::uint64_t>(baudRate) * divider;
+        std::uint64_t errorScaled = scaledFreq > wanted ? scaledFreq - wanted : wanted - scaledFreq;
+        if (errorScaled > static_cast<std::uint64_t>(maxError) * divider)
+          continue;
+        std::uint32_t error = static_cast<std::uint32_t>((errorScaled * 1000u + divider - 1) / divider);
+        if (best.brg == 0 || error < best.error) {
+          best = {mult, osr, static_cast<std::uint32_t>(candidate), static_cast<std::uint32_t>(scaledFreq / divider), error};
+        }
+      }
+    }
+  }
+  return best;
 }
 
-consteval uint32_t findClockFrequency(uint32_t inFreq, uint32_t cpuFreq) {
-  return libMcu::findLcm(inFreq, cpuFreq, mainClockMaxFreq);
+/**
+ * @brief Find the fractional generator multiplier that gives the most accurate USART baud rate
+ * @param inputFreq fractional generator input frequency
+ * @param baudRate wanted baud rate
+ * @return fractional generator multiplier
+ */
+consteval std::uint32_t findUsartFrgMult(std::uint32_t inputFreq, std::uint32_t baudRate) {
+  return findUsartBaudSettings(inputFreq, baudRate, 0, frgMaxMult, 0xFFFF'FFFFu).frgMult;
 }
 }  // namespace libMcuHw::clock
 
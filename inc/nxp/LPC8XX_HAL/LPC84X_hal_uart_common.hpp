@@ -69,6 +69,31 @@ enum class synchonousStates : std::uint8_t {
   CLAIMED,     /**< Interface is claimed, ready to transact */
   TRANSACTING, /**< Interface is busy with a transaction */
 };
+
+/**
+ * @brief convert a transmission length to the low level setting
+ * @param lengthBits bit length of transmissions
+ * @return low level transmission length
+ */
+constexpr inline libMcuLL::usart::uartLength toLL(uartLength lengthBits) {
+  return static_cast<libMcuLL::usart::uartLength>(lengthBits);
+}
+/**
+ * @brief convert a parity setting to the low level setting
+ * @param parity parity type of transmissions
+ * @return low level parity setting
+ */
+constexpr inline libMcuLL::usart::uartParity toLL(uartParity parity) {
+  return static_cast<libMcuLL::usart::uartParity>(parity);
+}
+/**
+ * @brief convert a stop bit setting to the low level setting
+ * @param stopBits amount of stop bits
+ * @return low level stop bit setting
+ */
+constexpr inline libMcuLL::usart::uartStop toLL(uartStop stopBits) {
+  return static_cast<libMcuLL::usart::uartStop>(stopBits);
+}
 }  // namespace detail
 
 }  // namespace libMcuHal::usart
@@ -26,33 +26,44 @@ struct uartAsync {
    */
   void initialize() {}
   /**
-   * @brief Setup USART to 8n1
+   * @brief Setup USART to 8n1, see libMcuLL::usart::usart::init for the baud rate calculation
+   * @tparam t_clockConfig clock configuration of this peripheral
    * @param baudRate Baud rate value
    * @return std::uint32_t actual baud rate
    */
-  template <auto& config>
+  template <const libMcuHw::clock::periClockConfig& t_clockConfig>
   constexpr std::uint32_t init(std::uint32_t baudRate) {
-    std::uint32_t baudDivider = getInputClockFreq<config>() / (baudRate * 16);
-    usartPeripheral()->BRG = baudDivider;
-    usartPeripheral()->CFG = hardware::CFG::ENABLE | static_cast<std::uint32_t>(uartLength::SIZE_8) |
-                             static_cast<std::uint32_t>(uartParity::NONE) | static_cast<std::uint32_t>(uartStop::STOP_1);
-    return getInputClockFreq<config>() / 16 / baudDivider;
+    return init<t_clockConfig>(baudRate, uartLength::SIZE_8, uartParity::NONE, uartStop::STOP_1);
   }
   /**
-   * @brief Setup USART
+   * @brief Setup USART, see libMcuLL::usart::usart::init for the baud rate calculation
+   * @tparam t_clockConfig clock configuration of this peripheral
    * @param baudRate Baud rate value
    * @param lengthBits bit length of transmissions, see uartLength enum for options
    * @param parity parity type of transmissions, see uartParity enum for options
    * @param stopBits Amount of stop bits, see uartStop enum for options
    * @return std::uint32_t actual baud rate
    */
-  template <auto& config>
+  template <const libMcuHw::clock::periClockConfig& t_clockConfig>
   constexpr std::uint32_t init(std::uint32_t baudRate, uartLength lengthBits, uartParity parity, uartStop stopBits) {
-    std::uint32_t baudDivider = getInputClockFreq<config>() / (baudRate * 16);
-    usartPeripheral()->BRG = baudDivider;
-    usartPeripheral()->CFG = hardware::CFG::ENABLE | static_cast<std::uint32_t>(lengthBits) | static_cast<std::uint32_t>(parity) |
-                             static_cast<std::uint32_t>(stopBits);
-    return getInputClockFreq<config>() / 16 / baudDivider;
+    return usartLL.template init<t_clockConfig>(baudRate, detail::toLL(lengthBits), detail::toLL(parity), detail::toLL(stopBits));
+  }
+  /**
+   * @brief Setup USART with settings computed at compile time, see libMcuLL::usart::usart::init
+   * @tparam t_clockConfig clock configuration of this peripheral
+   * @tparam t_baudRate Baud rate value
+   * @tparam t_maxError largest acceptable baud rate error in Hz, default is 1%
+   * @param lengthBits bit length of transmissions, see uartLength enum for options
+   * @param parity parity type of transmissions, see uartParity enum for options
+   * @param stopBits Amount of stop bits, see uartStop enum for options
+   * @return std::uint32_t actual baud rate
+   */
+  template <const libMcuHw::clock::periClockConfig& t_clockConfig, std::uint32_t t_baudRate,
+            std::uint32_t t_maxError = t_baudRate / 100>
+  constexpr std::uint32_t init(uartLength lengthBits = uartLength::SIZE_8, uartParity parity = uartParity::NONE,
+                               uartStop stopBits = uartStop::STOP_1) {
+    return usartLL.template init<t_clockConfig, t_baudRate, t_maxError>(detail::toLL(lengthBits), detail::toLL(parity),
+                                                                        detail::toLL(stopBits));
   }
   /**
    * @brief Claim the Usart interface
@@ -165,34 +176,12 @@ struct uartAsync {
   }
   /**
    * @brief get the input clock of this UART peripheral
-   * @tparam config clock configuration
+   * @tparam t_clockConfig clock configuration of this peripheral
    * @return current input clock frequency
    */
-  template <auto& config>
+  template <const libMcuHw::clock::periClockConfig& t_clockConfig>
   constexpr std::uint32_t getInputClockFreq() {
-    if constexpr (uartBaseAddress == libMcuHw::usart0Address) {
-      if constexpr (config.uart0Source == libMcuHw::clock::periSource::MAIN) {
-        return config.mainFreq;
-      } else
-        static_assert(false, "unsupported peripheral source!");
-    } else if constexpr (uartBaseAddress == libMcuHw::usart1Address) {
-      if constexpr (config.uart1Source == libMcuHw::clock::periSource::MAIN) {
-        return config.mainFreq;
-      } else
-        static_assert(false, "unsupported peripheral source!");
-    } else if constexpr (uartBaseAddress == libMcuHw::usart2Address) {
-      if constexpr (config.uart2Source == libMcuHw::clock::periSource::MAIN) {
-        return config.mainFreq;
-      } else
-        static_assert(false, "unsupported peripheral source!");
-    } else if constexpr (uartBaseAddress == libMcuHw::usart3Address) {
-      if constexpr (config.uart3Source == libMcuHw::clock::periSource::MAIN) {
-        return config.mainFreq;
-      } else
-        static_assert(false, "unsupported peripheral source!");
-    } else
-      static_assert(false, "Unknown UART address!");
-    return 0;
+    return usartLL.template getInputClockFreq<t_clockConfig>();
   }
 
  private:
@@ -211,6 +200,7 @@ struct uartAsync {
   std::size_t transactionReadIndex;                                          /**< transaction read buffer index */
   std::span<transferType> transactionWriteData;                              /**< data to write */
   std::span<transferType> transactionReadData;                               /**< where to put read data in */
+  libMcuLL::usart::usart<uartBaseAddress_, transferType> usartLL;            /**< low level USART, sets up the baud rate */
 };
 }  // namespace libMcuHal::usart
 
@@ -24,12 +24,14 @@ constexpr inline std::uint32_t RESERVED_MASK{0x06B0'3F58u};     /**< register ma
 constexpr inline std::uint32_t EDGESEL_FALLING{0u << 3};        /**< falling edges trigger COMPEDGE */
 constexpr inline std::uint32_t EDGESEL_RISING{1u << 3};         /**< rising edges trigger COMPEDGE */
 constexpr inline std::uint32_t EDGESEL_BOTH{2u << 3};           /**< both edges trigger COMPEDGE */
+constexpr inline std::uint32_t EDGESEL_MASK{3u << 3};           /**< edge select mask */
 constexpr inline std::uint32_t COMPSA_DIR{0u << 6};             /**< comparator output used directly */
 constexpr inline std::uint32_t COMPSA_SYNC{1u << 6};            /**< comparator output synchronized to bus clock */
 constexpr inline std::uint32_t COMP_VP_SEL_LAD{0u << 8};        /**< comparator plus connected to voltage ladder */
 constexpr inline std::uint32_t COMP_VP_SEL_ACMP_I1{1u << 8};    /**< comparator plus connected to ACMP_I1 */
 constexpr inline std::uint32_t COMP_VP_SEL_ACMP_I2{2u << 8};    /**< comparator plus connected to ACMP_I2 */
 constexpr inline std::uint32_t COMP_VP_SEL_ACMP_VREF{6u << 8};  /**< comparator plus connected to internal reference */
+constexpr inline std::uint32_t COMP_VP_SEL_MASK{7u << 8};       /**< comparator plus input select mask */
 constexpr inline std::uint32_t COMP_VM_SEL_LAD{0u << 11};       /**< comparator minus connected to voltage ladder */
 constexpr inline std::uint32_t COMP_VM_SEL_ACMP_I1{1u << 11};   /**< comparator minus connected to ACMP_I1 */
 constexpr inline std::uint32_t COMP_VM_SEL_ACMP_I2{2u << 11};   /**< comparator minus connected to ACMP_I2 */
@@ -25,6 +25,16 @@ struct crc {
     volatile std::uint8_t WRDATA8;    /**< CRC Data Register: write size 8-bit */
   };
 };
+namespace MODE {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'003Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CRC_POLY_CCITT{0u << 0};     /**< CRC-CCITT polynomial */
+constexpr inline std::uint32_t CRC_POLY_CRC16{1u << 0};     /**< CRC-16 polynomial */
+constexpr inline std::uint32_t CRC_POLY_CRC32{2u << 0};     /**< CRC-32 polynomial */
+constexpr inline std::uint32_t BIT_RVS_WR{1u << 2};         /**< bit reverse the written data */
+constexpr inline std::uint32_t CMPL_WR{1u << 3};            /**< one's complement the written data */
+constexpr inline std::uint32_t BIT_RVS_SUM{1u << 4};        /**< bit reverse the checksum */
+constexpr inline std::uint32_t CMPL_SUM{1u << 5};           /**< one's complement the checksum */
+}  // namespace MODE
 
 }  // namespace libMcuLL::hw::crc
 #endif
\ No newline at end of file
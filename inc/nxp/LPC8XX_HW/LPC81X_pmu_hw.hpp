@@ -20,5 +20,26 @@ struct pmu {
   volatile std::uint32_t GPREG[4]; /**< General purpose Registers 0..3 (R/W) */
   volatile std::uint32_t DPDCTRL;  /**< Deep power-down control register (R/W) */
 };
+namespace PCON {
+constexpr inline std::uint32_t RESERVED_MASK = 0x0000090Fu;   /**< register mask for allowed bits */
+constexpr inline std::uint32_t PM_MASK = (0x7 << 0);          /**< power mode mask */
+constexpr inline std::uint32_t PM_SLEEP = (0 << 0);           /**< WFI enters sleep or deep-sleep, depends on SCR */
+constexpr inline std::uint32_t PM_DEEP_SLEEP = (1 << 0);      /**< WFI with SLEEPDEEP enters deep-sleep */
+constexpr inline std::uint32_t PM_POWER_DOWN = (2 << 0);      /**< WFI with SLEEPDEEP enters power-down */
+constexpr inline std::uint32_t PM_DEEP_POWER_DOWN = (3 << 0); /**< WFI with SLEEPDEEP enters deep power-down */
+constexpr inline std::uint32_t NODPD = (1 << 3);              /**< prevent deep power-down mode until next reset */
+constexpr inline std::uint32_t SLEEPFLAG = (1 << 8);          /**< sleep, deep-sleep or power-down entered, write 1 to clear */
+constexpr inline std::uint32_t DPDFLAG = (1 << 11);           /**< deep power-down entered, write 1 to clear */
+}  // namespace PCON
+namespace GPREG {
+constexpr inline std::uint32_t RESERVED_MASK = 0xFFFFFFFFu; /**< register mask for allowed bits */
+}
+namespace DPDCTRL {
+constexpr inline std::uint32_t RESERVED_MASK = 0x0000000Fu; /**< register mask for allowed bits */
+constexpr inline std::uint32_t WAKEUPHYS = (1 << 0);       /**< WAKEUP pin hysteresis enabled */
+constexpr inline std::uint32_t WAKEPAD_DISABLE = (1 << 1); /**< WAKEUP pin disabled as deep power-down wake-up source */
+constexpr inline std::uint32_t LPOSCEN = (1 << 2);         /**< low-power oscillator enabled */
+constexpr inline std::uint32_t LPOSCDPDEN = (1 << 3);      /**< low-power oscillator stays on in deep power-down */
+}  // namespace DPDCTRL
 }  // namespace libMcuLL::hw::pmu
 #endif
\ No newline at end of file
@@ -227,19 +227,39 @@ namespace NMISRC {
 constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
 }
 namespace PINTSEL {
-constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK = 0x0000003Fu; /**< register mask for allowed bits */
+/**
+ * @brief Format pin interrupt source pin
+ *
+ * @param pin pin number, port * 32 + pin index
+ * @return formatted PINTSEL value
+ */
+constexpr inline std::uint32_t INTPIN(std::uint32_t pin) {
+  return pin & 0x3Fu;
 }
+}  // namespace PINTSEL
 namespace STARTERP0 {
 constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
 }
 namespace STARTERP1 {
-constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
-}
+constexpr inline std::uint32_t RESERVED_MASK = 0x0000B13Bu; /**< register mask for allowed bits */
+constexpr inline std::uint32_t SPI0 = (1 << 0);             /**< SPI0 interrupt wake-up */
+constexpr inline std::uint32_t SPI1 = (1 << 1);             /**< SPI1 interrupt wake-up */
+constexpr inline std::uint32_t USART0 = (1 << 3);           /**< USART0 interrupt wake-up */
+constexpr inline std::uint32_t USART1 = (1 << 4);           /**< USART1 interrupt wake-up */
+constexpr inline std::uint32_t USART2 = (1 << 5);           /**< USART2 interrupt wake-up */
+constexpr inline std::uint32_t I2C = (1 << 8);              /**< I2C interrupt wake-up */
+constexpr inline std::uint32_t WWDT = (1 << 12);            /**< WWDT interrupt wake-up */
+constexpr inline std::uint32_t BOD = (1 << 13);             /**< BOD interrupt wake-up */
+constexpr inline std::uint32_t WKT = (1 << 15);             /**< self wake-up timer interrupt wake-up */
+}  // namespace STARTERP1
 namespace PDSLEEPCFG {
-constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
-}
+constexpr inline std::uint32_t RESERVED_MASK = 0x00000048u; /**< register mask for allowed bits */
+constexpr inline std::uint32_t BOD_PD = (1 << 3);           /**< BOD powered down in deep-sleep and power-down */
+constexpr inline std::uint32_t WDTOSC_PD = (1 << 6);        /**< watchdog oscillator powered down in deep-sleep and power-down */
+}  // namespace PDSLEEPCFG
 namespace PDAWAKECFG {
-constexpr inline std::uint32_t RESERVED_MASK = 0x00000000u; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK = 0x000080EFu; /**< register mask for allowed bits */
 }
 namespace PDRUNCFG {
 constexpr inline std::uint32_t RESERVED_MASK = 0x000080EFu; /**< register mask for allowed bits */
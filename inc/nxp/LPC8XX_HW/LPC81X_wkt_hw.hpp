@@ -20,5 +20,15 @@ struct wkt {
   std::uint32_t Reserved[2];
   volatile std::uint32_t COUNT; /**< Alarm/Wakeup Timer Counter register */
 };
+namespace CTRL {
+constexpr inline std::uint32_t RESERVED_MASK = 0x00000007u; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CLKSEL_IRC = (0 << 0);       /**< clocked by the IRC divided by 16, 750 kHz */
+constexpr inline std::uint32_t CLKSEL_LPOSC = (1 << 0);     /**< clocked by the low-power oscillator, 10 kHz */
+constexpr inline std::uint32_t ALARMFLAG = (1 << 1);        /**< counter reached zero, write 1 to clear */
+constexpr inline std::uint32_t CLEARCTR = (1 << 2);         /**< stop and clear the counter */
+}  // namespace CTRL
+namespace COUNT {
+constexpr inline std::uint32_t RESERVED_MASK = 0xFFFFFFFFu; /**< register mask for allowed bits */
+}
 }  // namespace libMcuLL::hw::wkt
 #endif
\ No newline at end of file
@@ -27,5 +27,150 @@ struct capt {
   std::uint8_t RESERVED_2[4056];        /**< Reserved */
   volatile const std::uint32_t ID;      /**< Block ID */
 };
+namespace CTRL {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'BFFFu};  /**< register mask for allowed bits */
+constexpr inline std::uint32_t POLLMODE_MASK{3u << 0};       /**< polling mode mask */
+constexpr inline std::uint32_t POLLMODE_INACTIVE{0u << 0};   /**< no measurements */
+constexpr inline std::uint32_t POLLMODE_NOW{1u << 0};        /**< measure all selected X pins once, then inactive */
+constexpr inline std::uint32_t POLLMODE_CONTINUOUS{2u << 0}; /**< measure all selected X pins every poll period */
+constexpr inline std::uint32_t TYPE_NORMAL{0u << 2};         /**< normal measurement type */
+constexpr inline std::uint32_t TRIGGER_YH{0u << 4};          /**< measurement ends on the YH pin threshold */
+constexpr inline std::uint32_t TRIGGER_ACMP{1u << 4};        /**< measurement ends on the analog comparator output */
+constexpr inline std::uint32_t WAIT{1u << 5};                /**< wait until TOUCH is read before the next measurement */
+constexpr inline std::uint32_t DMA_NONE{0u << 6};            /**< no DMA requests */
+constexpr inline std::uint32_t DMA_TOUCH{1u << 6};           /**< DMA request on touch */
+constexpr inline std::uint32_t DMA_ALL{2u << 6};             /**< DMA request on touch and no touch */
+constexpr inline std::uint32_t DMA_ALL_TIMEOUT{3u << 6};     /**< DMA request on touch, no touch and time-out */
+constexpr inline std::uint32_t XPINUSE_HIGHZ{0u << 12};      /**< unselected X pins are high impedance */
+constexpr inline std::uint32_t XPINUSE_LOW{1u << 12};        /**< unselected X pins are driven low */
+constexpr inline std::uint32_t INCHANGE{1u << 15};           /**< previous CTRL write still in progress, read only */
+/**
+ * @brief Format functional clock divider
+ * @param divider division value, 1 to 16
+ * @return formatted data for CTRL
+ */
+constexpr inline std::uint32_t FDIV(std::uint32_t divider) {
+  return ((divider - 1) & 0xFu) << 8;
+}
+/**
+ * @brief Format X pin selection
+ * @param pins bit N selects X pin N
+ * @return formatted data for CTRL
+ */
+constexpr inline std::uint32_t XPINSEL(std::uint32_t pins) {
+  return (pins & 0xFFFFu) << 16;
+}
+}  // namespace CTRL
+namespace STATUS {
+constexpr inline std::uint32_t RESERVED_MASK{0x00FF'011Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t YESTOUCH{1u << 0};           /**< measurement detected a touch, write 1 to clear */
+constexpr inline std::uint32_t NOTOUCH{1u << 1};            /**< measurement detected no touch, write 1 to clear */
+constexpr inline std::uint32_t POLLDONE{1u << 2};           /**< all selected X pins measured, write 1 to clear */
+constexpr inline std::uint32_t TIMEOUT{1u << 3};            /**< measurement timed out, write 1 to clear */
+constexpr inline std::uint32_t OVERRUN{1u << 4};            /**< TOUCH overwritten before it was read, write 1 to clear */
+constexpr inline std::uint32_t BUSY{1u << 8};               /**< measurement in progress, read only */
+constexpr inline std::uint32_t FLAGS_MASK{0x0000'001Fu};    /**< all write 1 to clear flags */
+/**
+ * @brief Extract the highest available X pin
+ * @param status STATUS register value
+ * @return highest X pin index
+ */
+constexpr inline std::uint32_t XMAX(std::uint32_t status) {
+  return (status >> 16) & 0xFFu;
+}
+}  // namespace STATUS
+namespace POLL_TCNT {
+constexpr inline std::uint32_t RESERVED_MASK{0x8FFF'FFFFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t TCHLOWER{1u << 31};          /**< a touch lowers the count */
+/**
+ * @brief Format touch threshold
+ * @param threshold count that separates touch from no touch, 0 to 4095
+ * @return formatted data for POLL_TCNT
+ */
+constexpr inline std::uint32_t TCNT(std::uint32_t threshold) {
+  return (threshold & 0xFFFu) << 0;
+}
+/**
+ * @brief Format measurement time-out
+ * @param exponent time-out after 2^exponent functional clocks, 0 to 12
+ * @return formatted data for POLL_TCNT
+ */
+constexpr inline std::uint32_t TOUT(std::uint32_t exponent) {
+  return (exponent & 0xFu) << 12;
+}
+/**
+ * @brief Format delay between polling rounds
+ * @param delay delay in units of 4096 functional clocks, 0 to 255
+ * @return formatted data for POLL_TCNT
+ */
+constexpr inline std::uint32_t POLL(std::uint32_t delay) {
+  return (delay & 0xFFu) << 16;
+}
+/**
+ * @brief Format measurement settling delay
+ * @param delay 0 no delay, 1 3 clocks, 2 5 clocks, 3 9 clocks
+ * @return formatted data for POLL_TCNT
+ */
+constexpr inline std::uint32_t MDELAY(std::uint32_t delay) {
+  return (delay & 0x3u) << 24;
+}
+/**
+ * @brief Format reset (discharge) delay
+ * @param delay 0 no delay, 1 3 clocks, 2 5 clocks, 3 9 clocks
+ * @return formatted data for POLL_TCNT
+ */
+constexpr inline std::uint32_t RDELAY(std::uint32_t delay) {
+  return (delay & 0x3u) << 26;
+}
+}  // namespace POLL_TCNT
+namespace INTENSET {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'001Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t YESTOUCH{1u << 0};           /**< touch interrupt enable */
+constexpr inline std::uint32_t NOTOUCH{1u << 1};            /**< no touch interrupt enable */
+constexpr inline std::uint32_t POLLDONE{1u << 2};           /**< poll round done interrupt enable */
+constexpr inline std::uint32_t TIMEOUT{1u << 3};            /**< time-out interrupt enable */
+constexpr inline std::uint32_t OVERRUN{1u << 4};            /**< overrun interrupt enable */
+}  // namespace INTENSET
+namespace INTENCLR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'001Fu}; /**< register mask for allowed bits */
+}  // namespace INTENCLR
+namespace INTSTAT {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'001Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t YESTOUCH{1u << 0};           /**< touch interrupt */
+constexpr inline std::uint32_t NOTOUCH{1u << 1};            /**< no touch interrupt */
+constexpr inline std::uint32_t POLLDONE{1u << 2};           /**< poll round done interrupt */
+constexpr inline std::uint32_t TIMEOUT{1u << 3};            /**< time-out interrupt */
+constexpr inline std::uint32_t OVERRUN{1u << 4};            /**< overrun interrupt */
+}  // namespace INTSTAT
+namespace TOUCH {
+constexpr inline std::uint32_t RESERVED_MASK{0x80F3'FFFFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t ISTOUCH{1u << 16};           /**< measurement was a touch */
+constexpr inline std::uint32_t ISTO{1u << 17};              /**< measurement timed out */
+constexpr inline std::uint32_t CHANGE{1u << 31};            /**< register is being updated, read again */
+/**
+ * @brief Extract measurement count
+ * @param touch TOUCH register value
+ * @return count
+ */
+constexpr inline std::uint32_t COUNT(std::uint32_t touch) {
+  return (touch >> 0) & 0xFFFu;
+}
+/**
+ * @brief Extract measured X pin
+ * @param touch TOUCH register value
+ * @return X pin index
+ */
+constexpr inline std::uint32_t XVAL(std::uint32_t touch) {
+  return (touch >> 12) & 0xFu;
+}
+/**
+ * @brief Extract poll round sequence number
+ * @param touch TOUCH register value
+ * @return sequence number
+ */
+constexpr inline std::uint32_t SEQ(std::uint32_t touch) {
+  return (touch >> 20) & 0xFu;
+}
+}  // namespace TOUCH
 }  // namespace libMcuHw::capt
 #endif
\ No newline at end of file
@@ -20,7 +20,19 @@ struct crc {
   union {                             /* */
     volatile const std::uint32_t SUM; /**< CRC checksum register */
     volatile std::uint32_t WR_DATA;   /**< CRC data register */
+    volatile std::uint16_t WR_DATA16; /**< CRC data register, 16 bit write */
+    volatile std::uint8_t WR_DATA8;   /**< CRC data register, 8 bit write */
   };
 };
+namespace MODE {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'003Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CRC_POLY_CCITT{0u << 0};     /**< CRC-CCITT polynomial */
+constexpr inline std::uint32_t CRC_POLY_CRC16{1u << 0};     /**< CRC-16 polynomial */
+constexpr inline std::uint32_t CRC_POLY_CRC32{2u << 0};     /**< CRC-32 polynomial */
+constexpr inline std::uint32_t BIT_RVS_WR{1u << 2};         /**< bit reverse the written data */
+constexpr inline std::uint32_t CMPL_WR{1u << 3};            /**< one's complement the written data */
+constexpr inline std::uint32_t BIT_RVS_SUM{1u << 4};        /**< bit reverse the checksum */
+constexpr inline std::uint32_t CMPL_SUM{1u << 5};           /**< one's complement the checksum */
+}  // namespace MODE
 }  // namespace libMcuHw::crc
 #endif
\ No newline at end of file
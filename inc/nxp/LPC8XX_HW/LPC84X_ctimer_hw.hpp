@@ -30,5 +30,126 @@ struct ctimer {
   volatile std::uint32_t PWMC;        /**< PWM Control Register */
   volatile std::uint32_t MSR[4];      /**< Match Shadow Register */
 };
+namespace IR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'00FFu}; /**< register mask for allowed bits */
+/**
+ * @brief Format match channel interrupt flag
+ * @param channel match channel, 0 to 3
+ * @return formatted data for IR
+ */
+constexpr inline std::uint32_t MRINT(std::uint32_t channel) {
+  return 1u << (channel & 0x3u);
+}
+/**
+ * @brief Format capture channel interrupt flag
+ * @param channel capture channel, 0 to 3
+ * @return formatted data for IR
+ */
+constexpr inline std::uint32_t CRINT(std::uint32_t channel) {
+  return 1u << ((channel & 0x3u) + 4);
+}
+}  // namespace IR
+namespace TCR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0003u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CEN{1u << 0};                /**< counter enable */
+constexpr inline std::uint32_t CRST{1u << 1};               /**< counter reset, held until cleared */
+}  // namespace TCR
+namespace MCR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0F00'0FFFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t MRI{1u << 0};                /**< interrupt on match, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t MRR{1u << 1};                /**< reset TC on match, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t MRS{1u << 2};                /**< stop TC on match, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t MR_MASK{7u << 0};            /**< match actions mask, shift with CHANNEL_SHIFT */
+/**
+ * @brief Get the shift of the match actions of a channel
+ * @param channel match channel, 0 to 3
+ * @return bit shift of the channel actions
+ */
+constexpr inline std::uint32_t CHANNEL_SHIFT(std::uint32_t channel) {
+  return (channel & 0x3u) * 3;
+}
+/**
+ * @brief Format match register reload from its shadow register on a TC reset
+ * @param channel match channel, 0 to 3
+ * @return formatted data for MCR
+ */
+constexpr inline std::uint32_t MRRL(std::uint32_t channel) {
+  return 1u << ((channel & 0x3u) + 24);
+}
+}  // namespace MCR
+namespace CCR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0FFFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CAPRE{1u << 0};              /**< capture on rising edge, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t CAPFE{1u << 1};              /**< capture on falling edge, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t CAPI{1u << 2};               /**< interrupt on capture, shift with CHANNEL_SHIFT */
+constexpr inline std::uint32_t CAP_MASK{7u << 0};           /**< capture settings mask, shift with CHANNEL_SHIFT */
+/**
+ * @brief Get the shift of the capture settings of a channel
+ * @param channel capture channel, 0 to 3
+ * @return bit shift of the channel settings
+ */
+constexpr inline std::uint32_t CHANNEL_SHIFT(std::uint32_t channel) {
+  return (channel & 0x3u) * 3;
+}
+}  // namespace CCR
+namespace EMR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0FFFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t EMC_NOTHING{0u};             /**< match output unchanged on match */
+constexpr inline std::uint32_t EMC_CLEAR{1u};               /**< match output cleared on match */
+constexpr inline std::uint32_t EMC_SET{2u};                 /**< match output set on match */
+constexpr inline std::uint32_t EMC_TOGGLE{3u};              /**< match output toggled on match */
+/**
+ * @brief Format external match output state
+ * @param channel match channel, 0 to 3
+ * @return formatted data for EMR
+ */
+constexpr inline std::uint32_t EM(std::uint32_t channel) {
+  return 1u << (channel & 0x3u);
+}
+/**
+ * @brief Format external match control
+ * @param channel match channel, 0 to 3
+ * @param control one of the EMC_ values
+ * @return formatted data for EMR
+ */
+constexpr inline std::uint32_t EMC(std::uint32_t channel, std::uint32_t control) {
+  return (control & 0x3u) << ((channel & 0x3u) * 2 + 4);
+}
+}  // namespace EMR
+namespace CTCR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'00FFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CTMODE_TIMER{0u << 0};       /**< count every prescaled clock */
+constexpr inline std::uint32_t CTMODE_RISING{1u << 0};      /**< count rising edges of the selected input */
+constexpr inline std::uint32_t CTMODE_FALLING{2u << 0};     /**< count falling edges of the selected input */
+constexpr inline std::uint32_t CTMODE_BOTH{3u << 0};        /**< count both edges of the selected input */
+constexpr inline std::uint32_t ENCC{1u << 4};               /**< clear the counter on the edge selected by SELCC */
+/**
+ * @brief Format count input selection
+ * @param channel capture input, 0 to 3
+ * @return formatted data for CTCR
+ */
+constexpr inline std::uint32_t CINSEL(std::uint32_t channel) {
+  return (channel & 0x3u) << 2;
+}
+/**
+ * @brief Format counter clear edge selection
+ * @param selection CAPn rising edge at 2n, falling edge at 2n + 1
+ * @return formatted data for CTCR
+ */
+constexpr inline std::uint32_t SELCC(std::uint32_t selection) {
+  return (selection & 0x7u) << 5;
+}
+}  // namespace CTCR
+namespace PWMC {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< register mask for allowed bits */
+/**
+ * @brief Format PWM enable of a match channel
+ * @param channel match channel, 0 to 3
+ * @return formatted data for PWMC
+ */
+constexpr inline std::uint32_t PWMEN(std::uint32_t channel) {
+  return 1u << (channel & 0x3u);
+}
+}  // namespace PWMC
 }  // namespace libMcuHw::ctimer
 #endif
\ No newline at end of file
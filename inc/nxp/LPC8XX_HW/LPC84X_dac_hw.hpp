@@ -19,5 +19,35 @@ struct dac {
   volatile std::uint32_t CTRL;   /**< DAC Control register */
   volatile std::uint32_t CNTVAL; /**< DAC Counter Value register */
 };
+namespace CR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0001'FFC0u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t BIAS{1u << 16};              /**< 2.5 us settling time at lower current, 1 us when cleared */
+/**
+ * @brief Format output value
+ * @param value output value, 0 to 1023
+ * @return formatted data for CR
+ */
+constexpr inline std::uint32_t VALUE(std::uint32_t value) {
+  return (value & 0x3FFu) << 6;
+}
+}  // namespace CR
+namespace CTRL {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t INT_DMA_REQ{1u << 0};        /**< counter timed out, cleared by a CR write, read only */
+constexpr inline std::uint32_t DBLBUF_ENA{1u << 1};         /**< CR writes are buffered until the counter times out */
+constexpr inline std::uint32_t CNT_ENA{1u << 2};            /**< enable the time-out counter */
+constexpr inline std::uint32_t DMA_ENA{1u << 3};            /**< DMA request on a counter time-out */
+}  // namespace CTRL
+namespace CNTVAL {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'FFFFu}; /**< register mask for allowed bits */
+/**
+ * @brief Format counter reload value
+ * @param value reload value, the counter times out every value + 1 clocks
+ * @return formatted data for CNTVAL
+ */
+constexpr inline std::uint32_t VALUE(std::uint32_t value) {
+  return value & 0xFFFFu;
+}
+}  // namespace CNTVAL
 }  // namespace libMcuHw::dac
 #endif
\ No newline at end of file
@@ -22,7 +22,7 @@ struct dma {
   struct {                                  /*  */
     volatile std::uint32_t ENABLESET;       /**< Channel Enable read and Set */
     std::uint8_t RESERVED_0[4];             /**< Reserved */
-    volatile const std::uint32_t ENABLECLR; /**< Channel Enable Clear */
+    volatile std::uint32_t ENABLECLR;       /**< Channel Enable Clear */
     std::uint8_t RESERVED_1[4];             /**< Reserved */
     volatile std::uint32_t ACTIVE;          /**< Channel Active status */
     std::uint8_t RESERVED_2[4];             /**< Reserved */
@@ -32,17 +32,17 @@ struct dma {
     std::uint8_t RESERVED_4[4];             /**< Reserved */
     volatile std::uint32_t INTENSET;        /**< Interrupt Enable read and Set */
     std::uint8_t RESERVED_5[4];             /**< Reserved */
-    volatile const std::uint32_t INTENCLR;  /**< Interrupt Enable Clear */
+    volatile std::uint32_t INTENCLR;        /**< Interrupt Enable Clear */
     std::uint8_t RESERVED_6[4];             /**< Reserved */
     volatile std::uint32_t INTA;            /**< Interrupt A status */
     std::uint8_t RESERVED_7[4];             /**< Reserved */
     volatile std::uint32_t INTB;            /**< Interrupt B status */
     std::uint8_t RESERVED_8[4];             /**< Reserved */
-    volatile const std::uint32_t SETVALID;  /**< Set ValidPending control bits */
+    volatile std::uint32_t SETVALID;        /**< Set ValidPending control bits */
     std::uint8_t RESERVED_9[4];             /**< Reserved */
-    volatile const std::uint32_t SETTRIG;   /**< Set Trigger control bits */
+    volatile std::uint32_t SETTRIG;         /**< Set Trigger control bits */
     std::uint8_t RESERVED_10[4];            /**< Reserved */
-    volatile const std::uint32_t ABORT;     /**< Channel Abort control */
+    volatile std::uint32_t ABORT;           /**< Channel Abort control */
   } COMMON[1];                              /**< Common for all DMA channels */
   std::uint8_t RESERVED_1[900];             /**< Reserved */
   struct {                                  /*  */
@@ -52,5 +52,74 @@ struct dma {
     std::uint8_t RESERVED_0[4];             /**< Reserved */
   } CHANNEL[25];                            /**< Specific DMA channel  */
 };
+constexpr inline std::size_t channelCount{25};      /**< amount of DMA channels */
+constexpr inline std::uint32_t maxTransfers{1024u}; /**< maximum transfers of a single descriptor */
+namespace CTRL {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t ENABLE{1u << 0};             /**< DMA controller enable */
+}  // namespace CTRL
+namespace SRAMBASE {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FE00u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t ALIGNMENT{512u};             /**< required alignment of the descriptor table */
+}  // namespace SRAMBASE
+namespace CFG {
+constexpr inline std::uint32_t RESERVED_MASK{0x0007'CF73u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t PERIPHREQEN{1u << 0};        /**< transfers are paced by the peripheral DMA request */
+constexpr inline std::uint32_t HWTRIGEN{1u << 1};           /**< transfers are started by the hardware trigger */
+constexpr inline std::uint32_t TRIGPOL_HIGH{1u << 4};       /**< trigger is active high or on a rising edge */
+constexpr inline std::uint32_t TRIGTYPE_LEVEL{1u << 5};     /**< trigger is level sensitive instead of edge sensitive */
+constexpr inline std::uint32_t TRIGBURST{1u << 6};          /**< a trigger starts a burst instead of a complete transfer */
+constexpr inline std::uint32_t SRCBURSTWRAP{1u << 14};      /**< source address wraps after each burst */
+constexpr inline std::uint32_t DSTBURSTWRAP{1u << 15};      /**< destination address wraps after each burst */
+/**
+ * @brief Format burst size
+ * @param power burst size is 2^power transfers, 0 to 10
+ * @return formatted data for CFG
+ */
+constexpr inline std::uint32_t BURSTPOWER(std::uint32_t power) {
+  return (power & 0xFu) << 8;
+}
+/**
+ * @brief Format channel priority
+ * @param priority 0 is the highest priority, 7 the lowest
+ * @return formatted data for CFG
+ */
+constexpr inline std::uint32_t CHPRIORITY(std::uint32_t priority) {
+  return (priority & 0x7u) << 16;
+}
+}  // namespace CFG
+namespace CTLSTAT {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0005u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t VALIDPENDING{1u << 0};       /**< valid pending flag of the channel */
+constexpr inline std::uint32_t TRIG{1u << 2};               /**< channel is triggered */
+}  // namespace CTLSTAT
+namespace XFERCFG {
+constexpr inline std::uint32_t RESERVED_MASK{0x03FF'F33Fu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t CFGVALID{1u << 0};           /**< configuration is valid */
+constexpr inline std::uint32_t RELOAD{1u << 1};             /**< load the linked descriptor when exhausted */
+constexpr inline std::uint32_t SWTRIG{1u << 2};             /**< trigger the channel by software */
+constexpr inline std::uint32_t CLRTRIG{1u << 3};            /**< clear the trigger when exhausted */
+constexpr inline std::uint32_t SETINTA{1u << 4};            /**< set interrupt flag A when exhausted */
+constexpr inline std::uint32_t SETINTB{1u << 5};            /**< set interrupt flag B when exhausted */
+constexpr inline std::uint32_t WIDTH_8{0u << 8};            /**< 8 bit transfers */
+constexpr inline std::uint32_t WIDTH_16{1u << 8};           /**< 16 bit transfers */
+constexpr inline std::uint32_t WIDTH_32{2u << 8};           /**< 32 bit transfers */
+constexpr inline std::uint32_t SRCINC_NONE{0u << 12};       /**< source address is fixed */
+constexpr inline std::uint32_t SRCINC_1{1u << 12};          /**< source address increments by 1 width */
+constexpr inline std::uint32_t SRCINC_2{2u << 12};          /**< source address increments by 2 widths */
+constexpr inline std::uint32_t SRCINC_4{3u << 12};          /**< source address increments by 4 widths */
+constexpr inline std::uint32_t DSTINC_NONE{0u << 14};       /**< destination address is fixed */
+constexpr inline std::uint32_t DSTINC_1{1u << 14};          /**< destination address increments by 1 width */
+constexpr inline std::uint32_t DSTINC_2{2u << 14};          /**< destination address increments by 2 widths */
+constexpr inline std::uint32_t DSTINC_4{3u << 14};          /**< destination address increments by 4 widths */
+/**
+ * @brief Format transfer count
+ * @param count amount of transfers, 1 to 1024
+ * @return formatted data for XFERCFG
+ */
+constexpr inline std::uint32_t XFERCOUNT(std::uint32_t count) {
+  return ((count - 1) & 0x3FFu) << 16;
+}
+}  // namespace XFERCFG
 }  // namespace libMcuHw::dma
 #endif
\ No newline at end of file
@@ -15,5 +15,37 @@ namespace libMcuHw::faim {
  * @brief fast init memory register definitions
  */
 struct faim {};
+constexpr inline std::uint32_t wordCount{8u};    /**< FAIM words, a FAIM page holds one word */
+constexpr inline std::uint32_t firstPinWord{2u}; /**< first word with pin pull modes */
+constexpr inline std::uint32_t pinsPerWord{16u}; /**< pin pull modes in a word */
+constexpr inline std::uint32_t pinsPerPort{32u}; /**< pin pull mode slots of a port */
+namespace WORD0 {
+constexpr inline std::uint32_t LOW_POWER_BOOT{1u << 0}; /**< boot from the 1.5 MHz low power FRO setting instead of 12 MHz */
+}  // namespace WORD0
+namespace PIN {
+constexpr inline std::uint32_t INACTIVE{0u};  /**< no pullup/down at boot */
+constexpr inline std::uint32_t PULLDOWN{1u};  /**< pulldown enabled at boot */
+constexpr inline std::uint32_t PULLUP{2u};    /**< pullup enabled at boot */
+constexpr inline std::uint32_t REPEATER{3u};  /**< repeater mode at boot */
+constexpr inline std::uint32_t MODE_MASK{3u}; /**< pull mode field of a single pin */
+/**
+ * @brief word holding the pull mode of a pin
+ * @param port GPIO port index
+ * @param pin GPIO pin index
+ * @return FAIM word index
+ */
+constexpr inline std::uint32_t WORD(std::uint32_t port, std::uint32_t pin) {
+  return firstPinWord + (port * pinsPerPort + pin) / pinsPerWord;
+}
+/**
+ * @brief Format the pull mode of a pin
+ * @param pin GPIO pin index
+ * @param mode pull mode, INACTIVE, PULLDOWN, PULLUP or REPEATER
+ * @return formatted data for the word returned by WORD
+ */
+constexpr inline std::uint32_t MODE(std::uint32_t pin, std::uint32_t mode) {
+  return (mode & MODE_MASK) << ((pin % pinsPerWord) * 2u);
+}
+}  // namespace PIN
 }  // namespace libMcuHw::faim
 #endif
\ No newline at end of file
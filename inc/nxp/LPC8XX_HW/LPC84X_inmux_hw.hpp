@@ -21,5 +21,8 @@ struct inmux {
   std::uint8_t RESERVED_1[16];                /**< Reserved */
   volatile std::uint32_t DMA_ITRIG_INMUX[25]; /**< Trigger select register for DMA channel */
 };
+namespace DMA_ITRIG_INMUX {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'001Fu}; /**< register mask for allowed bits */
+}  // namespace DMA_ITRIG_INMUX
 }  // namespace libMcuHw::inmux
 #endif
\ No newline at end of file
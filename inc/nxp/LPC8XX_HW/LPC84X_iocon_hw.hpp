@@ -43,6 +43,8 @@ constexpr inline std::uint32_t IOCONCLKDIV4{4u << 13}; /**< use IOCONCLKDIV4 in
 constexpr inline std::uint32_t IOCONCLKDIV5{5u << 13}; /**< use IOCONCLKDIV5 in SYSCON */
 constexpr inline std::uint32_t IOCONCLKDIV6{6u << 13}; /**< use IOCONCLKDIV6 in SYSCON */
 constexpr inline std::uint32_t DACMODE{1 << 16};       /**< DAC mode enable */
+constexpr inline std::uint32_t DEFAULT{PULLUP};        /**< normal pin setting after reset, reserved bits excluded */
+constexpr inline std::uint32_t DEFAULT_I2C{I2C_STD};   /**< I2C pin setting after reset, reserved bits excluded */
 }  // namespace PIO
 }  // namespace libMcuHw::iocon
 #endif
\ No newline at end of file
@@ -20,5 +20,40 @@ struct mtb {
   volatile std::uint32_t FLOW;       /**< FLOW Register */
   volatile const std::uint32_t BASE; /**< Indicates where the SRAM is located in the processor memory map */
 };
+namespace POSITION {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFCu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t WRAP{1u << 2};              /**< Set when the pointer wrapped */
+constexpr inline std::uint32_t POINTER_MASK{0xFFFF'FFF8u}; /**< Trace packet write pointer mask */
+}  // namespace POSITION
+namespace MASTER {
+constexpr inline std::uint32_t RESERVED_MASK{0x8000'03FFu}; /**< register mask for allowed bits */
+/**
+ * @brief format trace buffer size
+ * @param mask buffer size is 2^(mask+4) bytes
+ * @return formatted MASK field
+ */
+constexpr inline std::uint32_t MASK(std::uint32_t mask) {
+  return (mask & 0x1Fu) << 0;
+}
+constexpr inline std::uint32_t TSTARTEN{1u << 5}; /**< Trace start input enable */
+constexpr inline std::uint32_t TSTOPEN{1u << 6};  /**< Trace stop input enable */
+constexpr inline std::uint32_t SFRWPRIV{1u << 7}; /**< Special function register write privilege */
+constexpr inline std::uint32_t RAMPRIV{1u << 8};  /**< SRAM privilege */
+constexpr inline std::uint32_t HALTREQ{1u << 9};  /**< Halt request */
+constexpr inline std::uint32_t EN{1u << 31};      /**< Main trace enable */
+}  // namespace MASTER
+namespace FLOW {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFBu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t AUTOSTOP{1u << 0};            /**< Stop tracing when the watermark is reached */
+constexpr inline std::uint32_t AUTOHALT{1u << 1};            /**< Halt the processor when the watermark is reached */
+/**
+ * @brief format watermark
+ * @param address trace pointer value to trigger on, must be 8 byte aligned
+ * @return formatted WATERMARK field
+ */
+constexpr inline std::uint32_t WATERMARK(std::uint32_t address) {
+  return address & 0xFFFF'FFF8u;
+}
+}  // namespace FLOW
 }  // namespace libMcuHw::mtb
 #endif
\ No newline at end of file
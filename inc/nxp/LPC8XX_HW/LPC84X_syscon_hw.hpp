@@ -213,8 +213,14 @@ constexpr inline std::uint32_t DIV(std::uint32_t divider) {
 }
 }  // namespace SYSAHBCLKDIV
 namespace CAPTCLKSEL {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
-}
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0007u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t FRO{0u << 0};                /**< FRO */
+constexpr inline std::uint32_t MAIN{1u << 0};               /**< Main clock */
+constexpr inline std::uint32_t SYS_PLL{2u << 0};            /**< System PLL */
+constexpr inline std::uint32_t FRO_DIV{3u << 0};            /**< FRO divided by 2 */
+constexpr inline std::uint32_t WATCHDOG{4u << 0};           /**< Watchdog oscillator */
+constexpr inline std::uint32_t NONE{7u << 0};               /**< No clock */
+}  // namespace CAPTCLKSEL
 namespace ADCCLKSEL {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
 }
@@ -326,14 +332,27 @@ constexpr inline std::uint32_t FRO_DIV{4u << 0};            /**< FRO divided by
 constexpr inline std::uint32_t NONE{7u << 0};               /**< No clock selected */
 }  // namespace FCLKSEL
 namespace FRGDIV {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
-}
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'00FFu}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t DIV_256{0xFFu << 0};         /**< Fractional divider denominator of 256, only supported value */
+}  // namespace FRGDIV
 namespace FRGMULT {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'00FFu}; /**< register mask for allowed bits */
+/**
+ * @brief Format fractional multiplier value
+ * @param multiplier numerator, output is input / (1 + multiplier / 256)
+ * @return formatted data for FRGMULT
+ */
+constexpr inline std::uint32_t MULT(std::uint32_t multiplier) {
+  return multiplier << 0;
 }
+}  // namespace FRGMULT
 namespace FRGCLKSEL {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
-}
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0003u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t FRO{0u << 0};                /**< FRO clock select */
+constexpr inline std::uint32_t MAIN{1u << 0};               /**< Main clock select */
+constexpr inline std::uint32_t SYS_PLL{2u << 0};            /**< System PLL clock select */
+constexpr inline std::uint32_t NONE{3u << 0};               /**< No clock selected */
+}  // namespace FRGCLKSEL
 namespace CLKOUTSEL {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'0007u}; /**< register mask for allowed bits */
 constexpr inline std::uint32_t FRO{0u << 0};                /**< FRO */
@@ -383,8 +402,16 @@ namespace NMISRC {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
 }
 namespace PINTSEL {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'003Fu}; /**< register mask for allowed bits */
+/**
+ * @brief Format pin interrupt source pin
+ * @param pin pin number, port * 32 + pin index
+ * @return formatted PINTSEL value
+ */
+constexpr inline std::uint32_t INTPIN(std::uint32_t pin) {
+  return pin & 0x3Fu;
 }
+}  // namespace PINTSEL
 namespace STARTERP0 {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
 }
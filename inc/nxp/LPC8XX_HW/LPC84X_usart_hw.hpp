@@ -113,7 +113,15 @@ namespace TXDAT {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'01FFu}; /**< register mask for allowed bits */
 }  // namespace TXDAT
 namespace BRG {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'FFFFu}; /**< register mask for allowed bits */
+/**
+ * @brief Format baud rate divider
+ * @param divider division value, 1 to 65536
+ * @return formatted data for BRG
+ */
+constexpr inline std::uint32_t BRGVAL(std::uint32_t divider) {
+  return (divider - 1) << 0;
+}
 }  // namespace BRG
 namespace INTSTAT {
 constexpr inline std::uint32_t RESERVED_MASK{0x0001'F96Du}; /**< register mask for allowed bits */
@@ -131,7 +139,15 @@ constexpr inline std::uint32_t RXNOISEINT{1u << 15};        /**< RX noise detect
 constexpr inline std::uint32_t ABERR{1u << 16};             /**< Autobaud error interrupt */
 }  // namespace INTSTAT
 namespace OSR {
-constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< register mask for allowed bits */
+/**
+ * @brief Format oversampling value
+ * @param oversampling clocks per bit, 5 to 16
+ * @return formatted data for OSR
+ */
+constexpr inline std::uint32_t OSRVAL(std::uint32_t oversampling) {
+  return (oversampling - 1) << 0;
+}
 }  // namespace OSR
 namespace ADDR {
 constexpr inline std::uint32_t RESERVED_MASK{0x0000'0000u}; /**< register mask for allowed bits */
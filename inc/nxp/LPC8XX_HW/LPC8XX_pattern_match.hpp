@@ -0,0 +1,226 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series pattern match engine expression compiler
+ */
+#ifndef LPC8XX_PATTERN_MATCH_HPP
+#define LPC8XX_PATTERN_MATCH_HPP
+
+namespace libMcuHw::patternMatch {
+constexpr inline std::size_t sliceCount{8};                /**< amount of bit slices */
+constexpr inline std::size_t inputCount{8};                /**< amount of pattern match inputs, the pin interrupt channels */
+constexpr inline std::uint32_t PMCTRL_SEL_PMATCH{1u << 0}; /**< pin interrupts are generated by the pattern match engine */
+constexpr inline std::uint32_t PMCTRL_ENA_RXEV{1u << 1};   /**< a match drives the RXEV signal of the core */
+/**
+ * @brief Extract the current product term match states
+ * @param pmctrl PMCTRL register value
+ * @return bit N set when the product term ending in slice N matches
+ */
+constexpr inline std::uint32_t PMCTRL_PMAT(std::uint32_t pmctrl) {
+  return pmctrl >> 24;
+}
+
+/**
+ * @brief bit slice match conditions
+ */
+enum class conditions : std::uint8_t {
+  ALWAYS = 0,      /**< constant true */
+  STICKY_RISE = 1, /**< rising edge seen since the last PMSRC write */
+  STICKY_FALL = 2, /**< falling edge seen since the last PMSRC write */
+  STICKY_EDGE = 3, /**< any edge seen since the last PMSRC write */
+  HIGH = 4,        /**< input is high */
+  LOW = 5,         /**< input is low */
+  NEVER = 6,       /**< constant false */
+  EVENT = 7,       /**< edge seen in the current clock cycle */
+};
+
+/**
+ * @brief Input with a match condition, a single bit slice
+ */
+struct literal {
+  std::uint8_t input;   /**< pin interrupt channel, 0 to 7 */
+  conditions condition; /**< condition for this input */
+};
+
+/**
+ * @brief Logical AND of literals, occupies consecutive bit slices
+ */
+struct product {
+  constexpr product() = default;
+  /**
+   * @brief product term of a single literal
+   * @param term literal
+   */
+  constexpr product(literal term) : literals{term}, count{1} {}
+  std::array<literal, sliceCount> literals{}; /**< literals of this term */
+  std::size_t count{0};                       /**< used literals, larger than sliceCount on overflow */
+};
+
+/**
+ * @brief Logical OR of product terms
+ */
+struct expression {
+  constexpr expression() = default;
+  /**
+   * @brief expression of a single product term
+   * @param term product term
+   */
+  constexpr expression(product term) : products{term}, count{1} {}
+  std::array<product, sliceCount> products{}; /**< product terms */
+  std::size_t count{0};                       /**< used product terms, larger than sliceCount on overflow */
+};
+
+/**
+ * @brief input is high
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal high(std::uint8_t input) {
+  return literal{input, conditions::HIGH};
+}
+/**
+ * @brief input is low
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal low(std::uint8_t input) {
+  return literal{input, conditions::LOW};
+}
+/**
+ * @brief input has seen a rising edge since the pattern was armed
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal rise(std::uint8_t input) {
+  return literal{input, conditions::STICKY_RISE};
+}
+/**
+ * @brief input has seen a falling edge since the pattern was armed
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal fall(std::uint8_t input) {
+  return literal{input, conditions::STICKY_FALL};
+}
+/**
+ * @brief input has seen any edge since the pattern was armed
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal edge(std::uint8_t input) {
+  return literal{input, conditions::STICKY_EDGE};
+}
+/**
+ * @brief input has an edge in the current clock cycle
+ * @param input pin interrupt channel
+ * @return literal
+ */
+constexpr inline literal event(std::uint8_t input) {
+  return literal{input, conditions::EVENT};
+}
+
+/**
+ * @brief AND a literal to a product term
+ * @param term product term
+ * @param factor literal to add
+ * @return extended product term
+ */
+constexpr inline product operator&(product term, literal factor) {
+  if (term.count < sliceCount)
+    term.literals[term.count] = factor;
+  term.count++;
+  return term;
+}
+/**
+ * @brief AND two literals
+ * @param a first literal
+ * @param b second literal
+ * @return product term
+ */
+constexpr inline product operator&(literal a, literal b) {
+  return product{a} & b;
+}
+/**
+ * @brief OR a product term to an expression
+ * @param sum expression
+ * @param term product term to add
+ * @return extended expression
+ */
+constexpr inline expression operator|(expression sum, product term) {
+  if (sum.count < sliceCount)
+    sum.products[sum.count] = term;
+  sum.count++;
+  return sum;
+}
+/**
+ * @brief OR two product terms
+ * @param a first product term
+ * @param b second product term
+ * @return expression
+ */
+constexpr inline expression operator|(product a, product b) {
+  return expression{a} | b;
+}
+/**
+ * @brief OR two literals
+ * @param a first literal
+ * @param b second literal
+ * @return expression
+ */
+constexpr inline expression operator|(literal a, literal b) {
+  return expression{product{a}} | product{b};
+}
+
+/**
+ * @brief Compiled pattern match engine configuration
+ */
+struct config {
+  std::uint32_t pmsrc;     /**< PMSRC register value */
+  std::uint32_t pmcfg;     /**< PMCFG register value */
+  std::uint32_t endpoints; /**< bit N set when a product term ends in slice N, its pin interrupt N fires on a match */
+  bool valid;              /**< expression fits in the bit slices */
+};
+
+/**
+ * @brief Compile a sum of products to bit slice settings
+ *
+ * Product terms are placed in consecutive slices in the order they are written, the last slice of each term is its end point.
+ * Slices left over are set to constant false, so the implicit end point of slice 7 never matches. Put parentheses around the
+ * product terms, for example `compile((rise(0) & low(1)) | (rise(1) & high(0)))`, to keep -Wparentheses quiet.
+ *
+ * @param sum expression to compile
+ * @return bit slice configuration, valid is false when the expression uses too many slices or an invalid input
+ */
+consteval config compile(expression sum) {
+  config result{0, 0, 0, true};
+  std::size_t slice = 0;
+  if (sum.count == 0 || sum.count > sliceCount)
+    result.valid = false;
+  for (std::size_t term = 0; result.valid && term < sum.count; term++) {
+    const product &factors = sum.products[term];
+    if (factors.count == 0 || factors.count > sliceCount || slice + factors.count > sliceCount) {
+      result.valid = false;
+      break;
+    }
+    for (std::size_t index = 0; index < factors.count; index++) {
+      const literal &factor = factors.literals[index];
+      if (factor.input >= inputCount)
+        result.valid = false;
+      result.pmsrc |= static_cast<std::uint32_t>(factor.input) << (8 + 3 * slice);
+      result.pmcfg |= static_cast<std::uint32_t>(factor.condition) << (8 + 3 * slice);
+      slice++;
+    }
+    result.endpoints |= 1u << (slice - 1);
+    if (slice - 1 < sliceCount - 1)
+      result.pmcfg |= 1u << (slice - 1);
+  }
+  for (; slice < sliceCount; slice++)
+    result.pmcfg |= static_cast<std::uint32_t>(conditions::NEVER) << (8 + 3 * slice);
+  return result;
+}
+}  // namespace libMcuHw::patternMatch
+#endif
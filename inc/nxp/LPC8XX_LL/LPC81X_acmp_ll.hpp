@@ -68,6 +68,7 @@ enum class ladderReferenceSetting : std::uint32_t {
  */
 template <libMcu::acmpBaseAddress const& acmpAddress_>
 struct acmp : libMcu::peripheralBase {
+  static constexpr std::uint32_t ladderSteps{32}; /**< amount of voltage ladder taps */
   /**
    * @brief Setup analog comparator
    * @param inPlus positive input connection
@@ -125,6 +126,43 @@ struct acmp : libMcu::peripheralBase {
   constexpr void setLadder(std::uint32_t value) {
     acmpPeripheral()->LAD = (acmpPeripheral()->LAD & ~hardware::LAD::LADSEL_MASK) | hardware::LAD::LADSEL(value);
   }
+  /**
+   * @brief change which edges the edge detector detects
+   * @param edges edge detector setting
+   */
+  constexpr void setEdgeDetector(edgeDetectSettings edges) {
+    acmpPeripheral()->CTRL = (acmpPeripheral()->CTRL & ~hardware::CTRL::EDGESEL_MASK) | static_cast<std::uint32_t>(edges);
+    clearEdgeDetector();
+  }
+  /**
+   * @brief compare the input against the voltage ladder, independent of the input the ladder is connected to
+   * @return true when the input is above the ladder voltage
+   */
+  constexpr bool isInputAboveLadder() {
+    bool ladderPositive = (acmpPeripheral()->CTRL & hardware::CTRL::COMP_VP_SEL_MASK) == hardware::CTRL::COMP_VP_SEL_LAD;
+    return (comparatorOutput() != 0) != ladderPositive;
+  }
+  /**
+   * @brief measure the input with a binary search over the voltage ladder taps
+   *
+   * The comparator needs to be setup with the ladder on one input and the voltage to measure on the other. Five ladder steps
+   * resolve the reading, the edge detector is cleared afterwards as the search toggles the comparator output.
+   *
+   * @param settleCycles delay after each ladder change for the ladder and comparator to settle, in delay loop cycles
+   * @return highest ladder tap below the input, 0 to 31
+   */
+  std::uint32_t measure(std::uint32_t settleCycles) {
+    std::uint32_t result = 0;
+    for (std::uint32_t step = ladderSteps / 2; step > 0; step = step >> 1) {
+      setLadder(result | step);
+      if (settleCycles > 0)
+        libMcuLL::delay(settleCycles);
+      if (isInputAboveLadder())
+        result = result | step;
+    }
+    clearEdgeDetector();
+    return result;
+  }
   /**
    * @brief reset edge detector
    */
@@ -143,5 +181,72 @@ struct acmp : libMcu::peripheralBase {
  private:
   static constexpr libMcu::hwAddressType acmpAddress{acmpAddress_}; /**< peripheral address */
 };
+/**
+ * @brief Interrupt driven threshold crossing monitor on the voltage ladder
+ *
+ * The edge detector interrupts on every comparator change, the interrupt handler then moves the ladder to the other threshold
+ * so crossings have hysteresis without polling. Setup the comparator with the ladder on one input, enable the comparator
+ * interrupt in the NVIC and call isr() from its handler.
+ *
+ * @tparam acmpAddress_ analog comparator address
+ */
+template <libMcu::acmpBaseAddress const& acmpAddress_>
+struct thresholdMonitor : libMcu::peripheralBase {
+  /**
+   * @brief start monitoring
+   * @param lowerTap ladder tap the input needs to fall below to count as low
+   * @param upperTap ladder tap the input needs to rise above to count as high, at least lowerTap
+   * @param settleCycles delay after a ladder change for the ladder and comparator to settle, in delay loop cycles
+   */
+  void start(std::uint32_t lowerTap, std::uint32_t upperTap, std::uint32_t settleCycles) {
+    lower = lowerTap;
+    upper = upperTap;
+    acmpLL.setLadder(upper);
+    if (settleCycles > 0)
+      libMcuLL::delay(settleCycles);
+    above = acmpLL.isInputAboveLadder();
+    if (above) {
+      acmpLL.setLadder(lower);
+      if (settleCycles > 0)
+        libMcuLL::delay(settleCycles);
+    }
+    crossings = 0;
+    acmpLL.setEdgeDetector(edgeDetectSettings::BOTH);
+  }
+  /**
+   * @brief get the input state
+   * @return true when the input is above the thresholds
+   */
+  bool isAbove() {
+    return above;
+  }
+  /**
+   * @brief get the amount of threshold crossings since start
+   * @return amount of crossings
+   */
+  std::uint32_t getCrossings() {
+    return crossings;
+  }
+  /**
+   * @brief Analog comparator interrupt service routine
+   */
+  void isr() {
+    if (acmpLL.edgeOutput() == 0)
+      return;
+    bool nowAbove = acmpLL.isInputAboveLadder();
+    if (nowAbove != above) {
+      above = nowAbove;
+      acmpLL.setLadder(above ? lower : upper);
+      crossings = crossings + 1;
+    }
+  }
+
+ private:
+  acmp<acmpAddress_> acmpLL;           /**< analog comparator */
+  std::uint32_t lower{0};              /**< lower threshold tap */
+  std::uint32_t upper{0};              /**< upper threshold tap */
+  volatile bool above{false};          /**< input above the thresholds */
+  volatile std::uint32_t crossings{0}; /**< threshold crossings since start */
+};
 }  // namespace libMcuLL::sw::acmp
 #endif
\ No newline at end of file
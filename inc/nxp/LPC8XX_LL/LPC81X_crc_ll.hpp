@@ -15,13 +15,52 @@ namespace hardware = hw::crc;
 
 template <libMcu::crcBaseAddress crcAddress_>
 struct crc : libMcu::peripheralBase {
+  /**
+   * @brief setup the CRC engine, also restarts the calculation
+   *
+   * @param mode MODE register value
+   * @param seed initial checksum
+   */
+  constexpr void init(std::uint32_t mode, std::uint32_t seed) {
+    crcPeripheral()->MODE = mode & hardware::MODE::RESERVED_MASK;
+    crcPeripheral()->SEED = seed;
+  }
+  /**
+   * @brief add bytes to the checksum
+   *
+   * @param data bytes to add
+   */
+  constexpr void write(std::span<const std::uint8_t> data) {
+    for (std::uint8_t byte : data)
+      crcPeripheral()->WRDATA8 = byte;
+  }
+  /**
+   * @brief get the checksum of all written data
+   *
+   * @return checksum
+   */
+  constexpr std::uint32_t getSum() {
+    return crcPeripheral()->SUM;
+  }
+  /**
+   * @brief calculate the reflected CRC-32 of bytes, the CRC used by Ethernet and zlib
+   *
+   * @param data bytes to calculate the CRC of
+   * @return CRC-32
+   */
+  constexpr std::uint32_t crc32(std::span<const std::uint8_t> data) {
+    init(hardware::MODE::CRC_POLY_CRC32 | hardware::MODE::BIT_RVS_WR | hardware::MODE::BIT_RVS_SUM | hardware::MODE::CMPL_SUM,
+         0xFFFF'FFFFu);
+    write(data);
+    return getSum();
+  }
   /**
    * @brief get registers from peripheral
    *
    * @return return pointer to CRC registers
    */
   constexpr static hw::crc::crc *crcPeripheral() {
-    return reinterpret_cast<hw::crc::crc *>(crcAddress_);
+    return reinterpret_cast<hw::crc::crc *>(crcAddress);
   }
 
  private:
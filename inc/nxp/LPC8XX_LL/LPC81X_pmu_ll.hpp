@@ -12,8 +12,85 @@
 
 namespace libMcuLL::sw::pmu {
 using namespace hw::pmu;
+
+/**
+ * @brief power modes entered by WFI, ordered from lightest to deepest
+ */
+enum class powerModes : std::uint32_t {
+  SLEEP = PCON::PM_SLEEP,                     /**< core clock stopped, peripherals keep running */
+  DEEP_SLEEP = PCON::PM_DEEP_SLEEP,           /**< clocks stopped, flash in standby, fast wake-up */
+  POWER_DOWN = PCON::PM_POWER_DOWN,           /**< clocks stopped, flash powered down, slower wake-up */
+  DEEP_POWER_DOWN = PCON::PM_DEEP_POWER_DOWN, /**< everything off except PMU, wake-up through reset, RAM is lost */
+};
+
 template <libMcu::pmuBaseAddress pmuAddress_>
 struct pmu {
+  /**
+   * @brief select the power mode entered by the next WFI
+   *
+   * Sleep mode is entered when SLEEPDEEP is cleared in the SCB SCR register, the other modes need SLEEPDEEP set.
+   *
+   * @param mode power mode to enter
+   */
+  constexpr void setPowerMode(powerModes mode) {
+    pmuPeripheral()->PCON = (pmuPeripheral()->PCON & PCON::NODPD) | static_cast<std::uint32_t>(mode);
+  }
+  /**
+   * @brief block deep power-down mode until the next reset
+   */
+  constexpr void preventDeepPowerDown() {
+    pmuPeripheral()->PCON = (pmuPeripheral()->PCON & (PCON::PM_MASK | PCON::NODPD)) | PCON::NODPD;
+  }
+  /**
+   * @brief get the low power mode flags
+   *
+   * @return PCON::SLEEPFLAG and/or PCON::DPDFLAG when these modes were entered
+   */
+  constexpr std::uint32_t getFlags() {
+    return pmuPeripheral()->PCON & (PCON::SLEEPFLAG | PCON::DPDFLAG);
+  }
+  /**
+   * @brief clear low power mode flags
+   *
+   * @param flags PCON::SLEEPFLAG and/or PCON::DPDFLAG
+   */
+  constexpr void clearFlags(std::uint32_t flags) {
+    pmuPeripheral()->PCON = (pmuPeripheral()->PCON & (PCON::PM_MASK | PCON::NODPD)) | (flags & (PCON::SLEEPFLAG | PCON::DPDFLAG));
+  }
+  /**
+   * @brief set deep power-down control
+   *
+   * @param setting bits from DPDCTRL, the low-power oscillator needs to be enabled to clock the wake-up timer
+   */
+  constexpr void setDeepPowerDownControl(std::uint32_t setting) {
+    pmuPeripheral()->DPDCTRL = setting & DPDCTRL::RESERVED_MASK;
+  }
+  /**
+   * @brief get deep power-down control
+   *
+   * @return current DPDCTRL setting
+   */
+  constexpr std::uint32_t getDeepPowerDownControl() {
+    return pmuPeripheral()->DPDCTRL;
+  }
+  /**
+   * @brief store a value in a general purpose register, these are retained in deep power-down
+   *
+   * @param index general purpose register index, 0 to 3
+   * @param value value to store
+   */
+  constexpr void storeRegister(std::uint32_t index, std::uint32_t value) {
+    pmuPeripheral()->GPREG[index] = value;
+  }
+  /**
+   * @brief load a value from a general purpose register
+   *
+   * @param index general purpose register index, 0 to 3
+   * @return stored value
+   */
+  constexpr std::uint32_t loadRegister(std::uint32_t index) {
+    return pmuPeripheral()->GPREG[index];
+  }
   /**
    * @brief get registers from peripheral
    *
@@ -27,4 +104,4 @@ struct pmu {
   static constexpr libMcu::hwAddressType pmuAddress = pmuAddress_; /**< peripheral address */
 };
 }  // namespace libMcuLL::sw::pmu
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC810 series low power mode manager
+ */
+#ifndef LPC81X_POWER_HPP
+#define LPC81X_POWER_HPP
+
+namespace libMcuLL::sw::power {
+using powerModes = pmu::powerModes;
+
+/**
+ * @brief Low power manager, enters the deepest power mode the active claims allow
+ *
+ * Drivers claim the deepest mode they can tolerate while they are active, for example a running asynchronous USART claims
+ * powerModes::SLEEP as it needs its clock, and release it when done. The wake-up timer runs from the low-power oscillator so it
+ * keeps counting in every mode and its interrupt is enabled as a deep-sleep wake-up source. The application needs to enable
+ * the wake-up timer interrupt in the NVIC and call wkt::clearAlarm() from its handler.
+ *
+ * @tparam pmuAddress_ power management unit address
+ * @tparam wktAddress_ wake-up timer address
+ * @tparam sysconAddress_ system control address
+ * @tparam t_deepestMode deepest mode to enter when nothing is claimed, deep power-down loses RAM and wakes through reset
+ */
+template <libMcu::pmuBaseAddress pmuAddress_, libMcu::wktBaseAddress wktAddress_, libMcu::sysconBaseAddress sysconAddress_,
+          powerModes t_deepestMode = powerModes::POWER_DOWN>
+struct powerManager : libMcu::peripheralBase {
+  /**
+   * @brief setup the wake-up timer, low-power oscillator and wake-up sources
+   */
+  void init() {
+    sysconLL.enablePeripheralClocks(syscon::peripheralClocks::WKT);
+    sysconLL.resetPeripherals(syscon::peripheralResets::WKT);
+    std::uint32_t dpdControl = pmuLL.getDeepPowerDownControl() | hw::pmu::DPDCTRL::LPOSCEN;
+    if constexpr (t_deepestMode == powerModes::DEEP_POWER_DOWN)
+      dpdControl = dpdControl | hw::pmu::DPDCTRL::LPOSCDPDEN;
+    pmuLL.setDeepPowerDownControl(dpdControl);
+    sysconLL.enableWakeupSources(syscon::wakeupSources::WKT);
+    claims.fill(0);
+  }
+  /**
+   * @brief claim a power mode, deeper modes are not entered until the claim is released
+   *
+   * @param deepest deepest mode the caller tolerates
+   */
+  void claim(powerModes deepest) {
+    claims[static_cast<std::uint32_t>(deepest)]++;
+  }
+  /**
+   * @brief release an earlier claim
+   *
+   * @param deepest mode passed to the matching claim call
+   */
+  void release(powerModes deepest) {
+    std::uint32_t index = static_cast<std::uint32_t>(deepest);
+    if (claims[index] > 0)
+      claims[index]--;
+  }
+  /**
+   * @brief get the power mode that will be entered by the next sleep call
+   *
+   * @return lightest claimed mode or t_deepestMode when nothing is claimed
+   */
+  powerModes getPowerMode() {
+    for (std::uint32_t index = 0; index < static_cast<std::uint32_t>(t_deepestMode); index++) {
+      if (claims[index] > 0)
+        return static_cast<powerModes>(index);
+    }
+    return t_deepestMode;
+  }
+  /**
+   * @brief enter the deepest allowed power mode until an interrupt or the next timer deadline
+   *
+   * Before deep-sleep and power-down the current power configuration is copied to PDAWAKECFG so everything running now is
+   * powered again on wake-up, a running system PLL is waited on until it locks again.
+   *
+   * @param ticks low-power oscillator ticks (about 10 kHz) until the next deadline, 0 to only wake on other interrupts
+   * @return power mode that was entered
+   */
+  powerModes sleep(std::uint32_t ticks = 0) {
+    powerModes mode = getPowerMode();
+    if (ticks > 0)
+      wktLL.start(wkt::clockSources::LPOSC, ticks);
+    pmuLL.setPowerMode(mode);
+    if (mode == powerModes::SLEEP) {
+      scbLL.scbPeripheral()->SCR = scbLL.scbPeripheral()->SCR & ~libMcuHw::scb::SCR::SLEEPDEEP;
+      libMcuLL::dsb();
+      libMcuLL::wfi();
+      return mode;
+    }
+    std::uint32_t running = sysconLL.getPeripheralPowers();
+    sysconLL.restorePowersOnWakeup();
+    scbLL.scbPeripheral()->SCR = scbLL.scbPeripheral()->SCR | libMcuHw::scb::SCR::SLEEPDEEP;
+    libMcuLL::dsb();
+    libMcuLL::wfi();
+    scbLL.scbPeripheral()->SCR = scbLL.scbPeripheral()->SCR & ~libMcuHw::scb::SCR::SLEEPDEEP;
+    if ((running & syscon::peripheralPowers::SYSPLL) == 0) {
+      while ((sysconLL.getSystemPllStatus() & hw::syscon::SYSPLLSTAT::LOCK) == 0)
+        ;
+    }
+    return mode;
+  }
+
+ private:
+  std::array<std::uint8_t, 4> claims{};           /**< active claims per power mode */
+  pmu::pmu<pmuAddress_> pmuLL;                    /**< power management unit */
+  wkt::wkt<wktAddress_> wktLL;                    /**< wake-up timer */
+  syscon::syscon<sysconAddress_> sysconLL;        /**< system control */
+  libMcuLL::scb::scb<libMcuHw::scbAddress> scbLL; /**< system control block */
+};
+}  // namespace libMcuLL::sw::power
+#endif
@@ -134,6 +134,32 @@ constexpr peripheralPowers operator|(const peripheralPowers a, const peripheralP
   return static_cast<peripheralPowers>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
 }
 
+/**
+ * @brief interrupts that can wake the part from deep-sleep and power-down
+ */
+enum class wakeupSources : std::uint32_t {
+  SPI0 = STARTERP1::SPI0,     /**< SPI0 interrupt */
+  SPI1 = STARTERP1::SPI1,     /**< SPI1 interrupt */
+  USART0 = STARTERP1::USART0, /**< USART0 interrupt */
+  USART1 = STARTERP1::USART1, /**< USART1 interrupt */
+  USART2 = STARTERP1::USART2, /**< USART2 interrupt */
+  I2C = STARTERP1::I2C,       /**< I2C interrupt */
+  WWDT = STARTERP1::WWDT,     /**< WWDT interrupt */
+  BOD = STARTERP1::BOD,       /**< BOD interrupt */
+  WKT = STARTERP1::WKT,       /**< self wake-up timer interrupt */
+};
+
+/**
+ * @brief operator | for wakeupSources
+ *
+ * @param a wake-up source
+ * @param b wake-up source
+ * @return ored value of wake-up sources
+ */
+constexpr wakeupSources operator|(const wakeupSources a, const wakeupSources b) {
+  return static_cast<wakeupSources>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
+
 template <libMcu::sysconBaseAddress sysconAddress_>
 struct syscon : libMcu::peripheralBase {
   /**
@@ -241,6 +267,57 @@ struct syscon : libMcu::peripheralBase {
   constexpr void depowerPeripherals(peripheralPowers setting) {
     sysconPeripheral()->PDRUNCFG = sysconPeripheral()->PDRUNCFG | (PDRUNCFG::RESERVED_MASK & static_cast<std::uint32_t>(setting));
   }
+  /**
+   * @brief Get the current power down configuration
+   *
+   * @return PDRUNCFG contents, a set bit means powered down
+   */
+  constexpr std::uint32_t getPeripheralPowers() {
+    return sysconPeripheral()->PDRUNCFG;
+  }
+  /**
+   * @brief Power up the current running configuration after waking from deep-sleep or power-down
+   */
+  constexpr void restorePowersOnWakeup() {
+    sysconPeripheral()->PDAWAKECFG = sysconPeripheral()->PDRUNCFG;
+  }
+  /**
+   * @brief Select peripherals that stay powered in deep-sleep and power-down
+   *
+   * @param setting only peripheralPowers::BOD and peripheralPowers::WDTOSC are allowed, others are always powered down
+   */
+  constexpr void setDeepSleepPowers(peripheralPowers setting) {
+    std::uint32_t powered = PDSLEEPCFG::RESERVED_MASK & static_cast<std::uint32_t>(setting);
+    sysconPeripheral()->PDSLEEPCFG = (sysconPeripheral()->PDSLEEPCFG | PDSLEEPCFG::RESERVED_MASK) & ~powered;
+  }
+  /**
+   * @brief Enable interrupts to wake up from deep-sleep and power-down
+   *
+   * @param setting bit setting from wakeupSources enum, the interrupt also needs to be enabled in the NVIC
+   */
+  constexpr void enableWakeupSources(wakeupSources setting) {
+    sysconPeripheral()->STARTERP1 =
+      sysconPeripheral()->STARTERP1 | (STARTERP1::RESERVED_MASK & static_cast<std::uint32_t>(setting));
+  }
+  /**
+   * @brief Disable interrupts to wake up from deep-sleep and power-down
+   *
+   * @param setting bit setting from wakeupSources enum
+   */
+  constexpr void disableWakeupSources(wakeupSources setting) {
+    sysconPeripheral()->STARTERP1 =
+      sysconPeripheral()->STARTERP1 & ~(STARTERP1::RESERVED_MASK & static_cast<std::uint32_t>(setting));
+  }
+  /**
+   * @brief connect a pin to a pin interrupt channel
+   *
+   * @param channel pin interrupt channel, 0 to 7
+   * @param pin pin to connect
+   */
+  template <typename PIN>
+  constexpr void selectPinInterrupt(std::uint32_t channel, PIN &pin) {
+    sysconPeripheral()->PINTSEL[channel] = PINTSEL::INTPIN(pin.gpioPortIndex * 32u + pin.gpioPinIndex);
+  }
   /**
    * @brief Get the DEVICE ID
    *
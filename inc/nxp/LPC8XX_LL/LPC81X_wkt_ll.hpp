@@ -12,8 +12,58 @@
 
 namespace libMcuLL::sw::wkt {
 using namespace libMcuLL::hw::wkt;
+
+/**
+ * @brief wakeup timer clock sources
+ */
+enum class clockSources : std::uint32_t {
+  IRC = CTRL::CLKSEL_IRC,     /**< IRC divided by 16, stops in deep-sleep and deeper */
+  LPOSC = CTRL::CLKSEL_LPOSC, /**< low-power oscillator, needs DPDCTRL::LPOSCEN in the PMU, keeps running in all modes */
+};
+
 template <libMcu::wktBaseAddress wktAddress_>
 struct wkt {
+  /**
+   * @brief start the timer, an alarm is raised when it counts down to zero
+   *
+   * A running count is stopped and cleared first.
+   *
+   * @param source clock to count down with
+   * @param count amount of clock ticks until the alarm, needs to be larger than 0
+   */
+  constexpr void start(clockSources source, std::uint32_t count) {
+    wktPeripheral()->CTRL = static_cast<std::uint32_t>(source) | CTRL::ALARMFLAG | CTRL::CLEARCTR;
+    wktPeripheral()->CTRL = static_cast<std::uint32_t>(source);
+    wktPeripheral()->COUNT = count;
+  }
+  /**
+   * @brief stop and clear the timer
+   */
+  constexpr void stop() {
+    wktPeripheral()->CTRL = (wktPeripheral()->CTRL & CTRL::CLKSEL_LPOSC) | CTRL::CLEARCTR;
+  }
+  /**
+   * @brief get the remaining ticks until the alarm
+   *
+   * @return remaining count
+   */
+  constexpr std::uint32_t getCount() {
+    return wktPeripheral()->COUNT;
+  }
+  /**
+   * @brief check if the timer reached zero
+   *
+   * @return true when the alarm flag is set
+   */
+  constexpr bool isAlarm() {
+    return (wktPeripheral()->CTRL & CTRL::ALARMFLAG) != 0;
+  }
+  /**
+   * @brief clear the alarm flag, call this from the wakeup timer interrupt
+   */
+  constexpr void clearAlarm() {
+    wktPeripheral()->CTRL = (wktPeripheral()->CTRL & CTRL::CLKSEL_LPOSC) | CTRL::ALARMFLAG;
+  }
   /**
    * @brief get registers from peripheral
    *
@@ -27,4 +77,4 @@ struct wkt {
   static constexpr libMcu::hwAddressType wktAddress = wktAddress_; /**< peripheral address */
 };
 }  // namespace libMcuLL::sw::wkt
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,284 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series capacitive touch low level functions
+ */
+#ifndef LPC84X_CAPT_LL_HPP
+#define LPC84X_CAPT_LL_HPP
+
+namespace libMcuLL::capt {
+namespace hardware = libMcuHw::capt;
+
+/**
+ * @brief measurement trigger
+ */
+enum class triggers : std::uint32_t {
+  YH_PIN = hardware::CTRL::TRIGGER_YH, /**< YH pin crossing its input threshold */
+  ACMP = hardware::CTRL::TRIGGER_ACMP, /**< analog comparator output */
+};
+
+/**
+ * @brief state of X pins that are not measured
+ */
+enum class unusedPins : std::uint32_t {
+  HIGH_Z = hardware::CTRL::XPINUSE_HIGHZ, /**< high impedance */
+  LOW = hardware::CTRL::XPINUSE_LOW,      /**< driven low */
+};
+
+/**
+ * @brief measurement delays, in functional clocks
+ */
+enum class delays : std::uint32_t {
+  NONE = 0,     /**< no delay */
+  CLOCKS_3 = 1, /**< 3 functional clocks */
+  CLOCKS_5 = 2, /**< 5 functional clocks */
+  CLOCKS_9 = 3, /**< 9 functional clocks */
+};
+
+/**
+ * @brief single measurement result
+ */
+struct measurement {
+  std::uint32_t xPin;  /**< measured X pin */
+  std::uint32_t count; /**< measured count */
+  bool isTouch;        /**< count crossed the threshold */
+  bool isTimeout;      /**< measurement timed out */
+};
+
+/**
+ * @brief Capacitive touch low level driver with an interrupt filled count buffer
+ *
+ * Every measurement interrupt stores the count of its X pin in a buffer, a completed polling round marks the buffer as ready.
+ * In continuous mode the hardware polls on its own so the core can sleep between rounds.
+ *
+ * @tparam captAddress_ CAPT peripheral address
+ * @tparam t_xPins amount of X pins in the count buffer, X pin N is stored at index N
+ */
+template <libMcu::captBaseAddress captAddress_, std::size_t t_xPins = 9>
+struct capt : libMcu::peripheralBase {
+  static_assert(t_xPins > 0 && t_xPins <= 16, "CAPT supports up to 16 X pins!");
+  /**
+   * @brief setup the CAPT peripheral, leaves it inactive
+   * @param xPins X pins to measure, bit N selects X pin N
+   * @param divider functional clock divider, 1 to 16
+   * @param trigger measurement trigger
+   * @param unused state of X pins while they are not measured
+   */
+  constexpr void init(std::uint32_t xPins, std::uint32_t divider, triggers trigger = triggers::YH_PIN,
+                      unusedPins unused = unusedPins::HIGH_Z) {
+    control = hardware::CTRL::XPINSEL(xPins) | hardware::CTRL::FDIV(divider) | static_cast<std::uint32_t>(trigger) |
+              static_cast<std::uint32_t>(unused) | hardware::CTRL::TYPE_NORMAL;
+    writeControl(hardware::CTRL::POLLMODE_INACTIVE);
+    captPeripheral()->STATUS = hardware::STATUS::FLAGS_MASK;
+    counts.fill(0);
+    scanReady = false;
+  }
+  /**
+   * @brief set the measurement rules
+   * @param threshold touch threshold count, 0 to 4095
+   * @param timeout measurement time-out after 2^timeout functional clocks, 0 to 12
+   * @param pollDelay delay between continuous polling rounds in units of 4096 functional clocks, 0 to 255
+   * @param measureDelay settling delay before a measurement
+   * @param resetDelay discharge time of the X pins
+   */
+  constexpr void setTiming(std::uint32_t threshold, std::uint32_t timeout, std::uint32_t pollDelay,
+                           delays measureDelay = delays::NONE, delays resetDelay = delays::NONE) {
+    captPeripheral()->POLL_TCNT = hardware::POLL_TCNT::TCNT(threshold) | hardware::POLL_TCNT::TOUT(timeout) |
+                                  hardware::POLL_TCNT::POLL(pollDelay) |
+                                  hardware::POLL_TCNT::MDELAY(static_cast<std::uint32_t>(measureDelay)) |
+                                  hardware::POLL_TCNT::RDELAY(static_cast<std::uint32_t>(resetDelay)) |
+                                  hardware::POLL_TCNT::TCHLOWER;
+  }
+  /**
+   * @brief change the X pins to measure, takes effect at the next polling round
+   * @param xPins X pins to measure, bit N selects X pin N
+   */
+  constexpr void setPins(std::uint32_t xPins) {
+    std::uint32_t pollMode = captPeripheral()->CTRL & hardware::CTRL::POLLMODE_MASK;
+    control = (control & ~hardware::CTRL::XPINSEL(0xFFFFu)) | hardware::CTRL::XPINSEL(xPins);
+    writeControl(pollMode);
+  }
+  /**
+   * @brief measure all selected X pins once
+   */
+  constexpr void pollNow() {
+    writeControl(hardware::CTRL::POLLMODE_NOW);
+  }
+  /**
+   * @brief measure all selected X pins every poll period until stopped
+   */
+  constexpr void startContinuous() {
+    writeControl(hardware::CTRL::POLLMODE_CONTINUOUS);
+  }
+  /**
+   * @brief stop measuring
+   */
+  constexpr void stop() {
+    writeControl(hardware::CTRL::POLLMODE_INACTIVE);
+  }
+  /**
+   * @brief check if a measurement is in progress
+   * @return true when busy
+   */
+  constexpr bool isBusy() {
+    return (captPeripheral()->STATUS & hardware::STATUS::BUSY) != 0;
+  }
+  /**
+   * @brief enable the interrupts that fill the count buffer
+   */
+  constexpr void enableInterrupts() {
+    captPeripheral()->STATUS = hardware::STATUS::FLAGS_MASK;
+    captPeripheral()->INTENSET = hardware::INTENSET::YESTOUCH | hardware::INTENSET::NOTOUCH | hardware::INTENSET::TIMEOUT |
+                                 hardware::INTENSET::POLLDONE;
+  }
+  /**
+   * @brief disable all CAPT interrupts
+   */
+  constexpr void disableInterrupts() {
+    captPeripheral()->INTENCLR = hardware::INTENCLR::RESERVED_MASK;
+  }
+  /**
+   * @brief read the last measurement
+   * @return last measurement result
+   */
+  constexpr measurement read() {
+    std::uint32_t touch;
+    do {
+      touch = captPeripheral()->TOUCH;
+    } while (touch & hardware::TOUCH::CHANGE);
+    return measurement{hardware::TOUCH::XVAL(touch), hardware::TOUCH::COUNT(touch), (touch & hardware::TOUCH::ISTOUCH) != 0,
+                       (touch & hardware::TOUCH::ISTO) != 0};
+  }
+  /**
+   * @brief check if a complete polling round is stored in the count buffer
+   * @return true when a new round is available
+   */
+  constexpr bool isScanReady() {
+    return scanReady;
+  }
+  /**
+   * @brief get the count buffer and mark the round as consumed
+   * @return counts of each X pin, timed out measurements store the maximum count
+   */
+  constexpr std::span<const std::uint16_t, t_xPins> getCounts() {
+    scanReady = false;
+    return std::span<const std::uint16_t, t_xPins>{counts};
+  }
+  /**
+   * @brief CAPT interrupt service routine
+   */
+  constexpr void isr() {
+    std::uint32_t status = captPeripheral()->INTSTAT;
+    if (status & (hardware::INTSTAT::YESTOUCH | hardware::INTSTAT::NOTOUCH | hardware::INTSTAT::TIMEOUT)) {
+      measurement result = read();
+      if (result.xPin < t_xPins)
+        counts[result.xPin] = static_cast<std::uint16_t>(result.isTimeout ? maxCount : result.count);
+    }
+    if (status & hardware::INTSTAT::POLLDONE)
+      scanReady = true;
+    captPeripheral()->STATUS = status & hardware::STATUS::FLAGS_MASK;
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to CAPT registers
+   */
+  constexpr static hardware::capt *captPeripheral() {
+    return reinterpret_cast<hardware::capt *>(captAddress);
+  }
+
+ private:
+  /**
+   * @brief write the control register, waits until a previous write is processed
+   * @param pollMode polling mode to set
+   */
+  constexpr void writeControl(std::uint32_t pollMode) {
+    while (captPeripheral()->CTRL & hardware::CTRL::INCHANGE)
+      ;
+    captPeripheral()->CTRL = control | pollMode;
+  }
+
+  static constexpr libMcu::hwAddressType captAddress = captAddress_; /**< peripheral address */
+  static constexpr std::uint32_t maxCount{0xFFFu};                   /**< count stored for a time-out */
+  std::array<std::uint16_t, t_xPins> counts{};                       /**< last count of each X pin */
+  std::uint32_t control{0};                                          /**< control settings without polling mode */
+  volatile bool scanReady{false};                                    /**< complete polling round in counts */
+};
+
+/**
+ * @brief Touch detection with baseline tracking and hysteresis
+ *
+ * A touch lowers the count. Each key tracks its untouched count as baseline with a first order filter, the baseline is frozen
+ * while a key is touched so a long touch is not learned as the new baseline. A key becomes touched when its count drops
+ * touchThreshold below the baseline and released when it rises to within releaseThreshold of it.
+ *
+ * @tparam t_keys amount of keys
+ * @tparam t_filterShift baseline filter strength, each update moves the baseline 1/2^t_filterShift towards the count
+ */
+template <std::size_t t_keys, std::uint32_t t_filterShift = 4>
+struct touchEngine {
+  static_assert(t_keys > 0 && t_keys <= 32, "touch state is kept in a 32 bit mask!");
+  static_assert(t_filterShift < 16, "filter shift too large!");
+  /**
+   * @brief seed the baselines from untouched counts
+   * @param initialCounts counts of all keys while nothing touches them
+   * @param touchThreshold count drop below the baseline that is a touch
+   * @param releaseThreshold count drop below the baseline to release a touch, smaller than touchThreshold
+   */
+  constexpr void init(std::span<const std::uint16_t, t_keys> initialCounts, std::uint32_t touchThreshold,
+                      std::uint32_t releaseThreshold) {
+    touchLevel = touchThreshold;
+    releaseLevel = releaseThreshold;
+    touched = 0;
+    for (std::size_t key = 0; key < t_keys; key++)
+      baselines[key] = static_cast<std::uint32_t>(initialCounts[key]) << t_filterShift;
+  }
+  /**
+   * @brief process a new polling round
+   * @param newCounts counts of all keys
+   * @return touched keys, bit N set when key N is touched
+   */
+  constexpr std::uint32_t update(std::span<const std::uint16_t, t_keys> newCounts) {
+    for (std::size_t key = 0; key < t_keys; key++) {
+      std::uint32_t keyBit = 1u << key;
+      std::uint32_t baseline = getBaseline(key);
+      std::uint32_t count = newCounts[key];
+      std::uint32_t drop = baseline > count ? baseline - count : 0u;
+      if (touched & keyBit) {
+        if (drop <= releaseLevel)
+          touched = touched & ~keyBit;
+      } else if (drop >= touchLevel) {
+        touched = touched | keyBit;
+      } else {
+        baselines[key] = baselines[key] - baseline + count;
+      }
+    }
+    return touched;
+  }
+  /**
+   * @brief get the touched keys of the last update
+   * @return touched keys, bit N set when key N is touched
+   */
+  constexpr std::uint32_t getTouched() const {
+    return touched;
+  }
+  /**
+   * @brief get the baseline of a key
+   * @param key key index
+   * @return untouched count
+   */
+  constexpr std::uint32_t getBaseline(std::size_t key) const {
+    return baselines[key] >> t_filterShift;
+  }
+
+ private:
+  std::array<std::uint32_t, t_keys> baselines{}; /**< baselines with t_filterShift fractional bits */
+  std::uint32_t touchLevel{0};                   /**< touch threshold */
+  std::uint32_t releaseLevel{0};                 /**< release threshold */
+  std::uint32_t touched{0};                      /**< touched keys */
+};
+}  // namespace libMcuLL::capt
+#endif
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series CRC engine low level functions
+ */
+#ifndef LPC84X_CRC_LL_HPP
+#define LPC84X_CRC_LL_HPP
+
+namespace libMcuLL::crc {
+namespace hardware = libMcuHw::crc;
+
+/**
+ * @brief CRC engine low level driver
+ *
+ * The CRC engine clock needs to be enabled in SYSCON before use.
+ *
+ * @tparam crcAddress_ CRC peripheral address
+ */
+template <libMcu::crcBaseAddress crcAddress_>
+struct crc : libMcu::peripheralBase {
+  /**
+   * @brief setup the CRC engine, also restarts the calculation
+   * @param mode MODE register value
+   * @param seed initial checksum
+   */
+  constexpr void init(std::uint32_t mode, std::uint32_t seed) {
+    crcPeripheral()->MODE = mode & hardware::MODE::RESERVED_MASK;
+    crcPeripheral()->SEED = seed;
+  }
+  /**
+   * @brief add bytes to the checksum
+   * @param data bytes to add
+   */
+  constexpr void write(std::span<const std::uint8_t> data) {
+    for (std::uint8_t byte : data)
+      crcPeripheral()->WR_DATA8 = byte;
+  }
+  /**
+   * @brief get the checksum of all written data
+   * @return checksum
+   */
+  constexpr std::uint32_t getSum() {
+    return crcPeripheral()->SUM;
+  }
+  /**
+   * @brief calculate the reflected CRC-32 of bytes, the CRC used by Ethernet and zlib
+   * @param data bytes to calculate the CRC of
+   * @return CRC-32
+   */
+  constexpr std::uint32_t crc32(std::span<const std::uint8_t> data) {
+    init(hardware::MODE::CRC_POLY_CRC32 | hardware::MODE::BIT_RVS_WR | hardware::MODE::BIT_RVS_SUM | hardware::MODE::CMPL_SUM,
+         0xFFFF'FFFFu);
+    write(data);
+    return getSum();
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to CRC registers
+   */
+  constexpr static hardware::crc *crcPeripheral() {
+    return reinterpret_cast<hardware::crc *>(crcAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType crcAddress = crcAddress_; /**< peripheral address */
+};
+}  // namespace libMcuLL::crc
+#endif
@@ -0,0 +1,233 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series standard counter/timer low level functions
+ */
+#ifndef LPC84X_CTIMER_LL_HPP
+#define LPC84X_CTIMER_LL_HPP
+
+namespace libMcuLL::ctimer {
+namespace hardware = libMcuHw::ctimer;
+
+/**
+ * @brief actions taken when the counter reaches a match value
+ */
+enum class matchActions : std::uint32_t {
+  NONE = 0,                                                  /**< no action */
+  INTERRUPT = hardware::MCR::MRI,                            /**< set the match interrupt flag */
+  RESET = hardware::MCR::MRR,                                /**< reset the counter */
+  STOP = hardware::MCR::MRS,                                 /**< stop the counter */
+  RESET_INTERRUPT = hardware::MCR::MRR | hardware::MCR::MRI, /**< reset the counter and set the interrupt flag */
+  STOP_INTERRUPT = hardware::MCR::MRS | hardware::MCR::MRI,  /**< stop the counter and set the interrupt flag */
+};
+
+/**
+ * @brief match output pin change on a match
+ */
+enum class matchOutputs : std::uint32_t {
+  NOTHING = hardware::EMR::EMC_NOTHING, /**< output unchanged */
+  CLEAR = hardware::EMR::EMC_CLEAR,     /**< output low */
+  SET = hardware::EMR::EMC_SET,         /**< output high */
+  TOGGLE = hardware::EMR::EMC_TOGGLE,   /**< output toggles */
+};
+
+/**
+ * @brief capture input edges that store the counter
+ */
+enum class captureEdges : std::uint32_t {
+  RISING = hardware::CCR::CAPRE,                      /**< rising edge */
+  FALLING = hardware::CCR::CAPFE,                     /**< falling edge */
+  BOTH = hardware::CCR::CAPRE | hardware::CCR::CAPFE, /**< both edges */
+};
+
+/**
+ * @brief Standard counter/timer low level driver
+ *
+ * The counter runs from the prescaled system clock. Each match channel can interrupt, reset or stop the counter and drive its
+ * match output, in PWM mode the output is low from the start of the period until the match value and high for the rest of it.
+ * Capture channels store the counter on an input edge, the time stamp is taken by hardware so it has no interrupt latency.
+ * Matches on channel 0 and 1 also raise a DMA request, route it to a DMA channel with inmux::selectDmaTrigger and the
+ * ctimer0Match0 or ctimer0Match1 trigger source.
+ *
+ * @tparam ctimerAddress_ CTIMER peripheral address
+ */
+template <libMcu::ctimerBaseAddress ctimerAddress_>
+struct ctimer : libMcu::peripheralBase {
+  /**
+   * @brief setup the counter in timer mode, stopped at zero with all channels disabled
+   * @param prescaler counter increments every prescaler system clocks, 1 to 2^32
+   */
+  constexpr void init(std::uint32_t prescaler) {
+    ctimerPeripheral()->TCR = hardware::TCR::CRST;
+    ctimerPeripheral()->PR = prescaler - 1;
+    ctimerPeripheral()->MCR = 0;
+    ctimerPeripheral()->CCR = 0;
+    ctimerPeripheral()->EMR = 0;
+    ctimerPeripheral()->CTCR = hardware::CTCR::CTMODE_TIMER;
+    ctimerPeripheral()->PWMC = 0;
+    ctimerPeripheral()->IR = hardware::IR::RESERVED_MASK;
+    ctimerPeripheral()->TCR = 0;
+  }
+  /**
+   * @brief change the prescaler
+   * @param prescaler counter increments every prescaler system clocks, 1 to 2^32
+   */
+  constexpr void setPrescaler(std::uint32_t prescaler) {
+    ctimerPeripheral()->PR = prescaler - 1;
+  }
+  /**
+   * @brief start counting
+   */
+  constexpr void start() {
+    ctimerPeripheral()->TCR = hardware::TCR::CEN;
+  }
+  /**
+   * @brief stop counting, the counter keeps its value
+   */
+  constexpr void stop() {
+    ctimerPeripheral()->TCR = 0;
+  }
+  /**
+   * @brief reset the counter and prescaler to zero, keeps the counter running when it was running
+   */
+  constexpr void reset() {
+    std::uint32_t control = ctimerPeripheral()->TCR & hardware::TCR::CEN;
+    ctimerPeripheral()->TCR = control | hardware::TCR::CRST;
+    ctimerPeripheral()->TCR = control;
+  }
+  /**
+   * @brief get the counter value
+   * @return counter value
+   */
+  constexpr std::uint32_t getCount() {
+    return ctimerPeripheral()->TC;
+  }
+  /**
+   * @brief setup a match channel
+   * @param channel match channel, 0 to 3
+   * @param value counter value to match
+   * @param actions counter actions on a match
+   * @param output match output change on a match
+   */
+  constexpr void setMatch(std::uint32_t channel, std::uint32_t value, matchActions actions = matchActions::NONE,
+                          matchOutputs output = matchOutputs::NOTHING) {
+    std::uint32_t shift = hardware::MCR::CHANNEL_SHIFT(channel);
+    ctimerPeripheral()->MR[channel] = value;
+    ctimerPeripheral()->MCR =
+      (ctimerPeripheral()->MCR & ~(hardware::MCR::MR_MASK << shift)) | (static_cast<std::uint32_t>(actions) << shift);
+    ctimerPeripheral()->EMR = (ctimerPeripheral()->EMR & ~hardware::EMR::EMC(channel, hardware::EMR::EMC_TOGGLE)) |
+                              hardware::EMR::EMC(channel, static_cast<std::uint32_t>(output));
+  }
+  /**
+   * @brief change a match value at the next counter reset
+   *
+   * The value goes to the shadow register and is loaded when the counter resets, so a running period or PWM duty cycle is
+   * never cut short. A DMA channel can write the shadow registers for updates without the CPU.
+   *
+   * @param channel match channel, 0 to 3
+   * @param value counter value to match
+   */
+  constexpr void updateMatch(std::uint32_t channel, std::uint32_t value) {
+    ctimerPeripheral()->MSR[channel] = value;
+    ctimerPeripheral()->MCR = ctimerPeripheral()->MCR | hardware::MCR::MRRL(channel);
+  }
+  /**
+   * @brief get the state of the match outputs
+   * @return bit N set when match output N is high
+   */
+  constexpr std::uint32_t getMatchOutputs() {
+    return ctimerPeripheral()->EMR & (hardware::EMR::EM(0) | hardware::EMR::EM(1) | hardware::EMR::EM(2) | hardware::EMR::EM(3));
+  }
+  /**
+   * @brief setup PWM mode with a match channel as period
+   * @param periodChannel match channel that resets the counter, it has no PWM output
+   * @param period counts per period
+   */
+  constexpr void initPwm(std::uint32_t periodChannel, std::uint32_t period) {
+    setMatch(periodChannel, period - 1, matchActions::RESET);
+    ctimerPeripheral()->PWMC = ctimerPeripheral()->PWMC & ~hardware::PWMC::PWMEN(periodChannel);
+  }
+  /**
+   * @brief enable PWM on a match channel
+   * @param channel match channel, 0 to 3, not the period channel
+   * @param value output is low until the counter reaches this value, 0 keeps the output high
+   */
+  constexpr void setPwm(std::uint32_t channel, std::uint32_t value) {
+    ctimerPeripheral()->MR[channel] = value;
+    ctimerPeripheral()->PWMC = ctimerPeripheral()->PWMC | hardware::PWMC::PWMEN(channel);
+  }
+  /**
+   * @brief disable PWM on a match channel, the output is controlled by the match output setting again
+   * @param channel match channel, 0 to 3
+   */
+  constexpr void disablePwm(std::uint32_t channel) {
+    ctimerPeripheral()->PWMC = ctimerPeripheral()->PWMC & ~hardware::PWMC::PWMEN(channel);
+  }
+  /**
+   * @brief setup a capture channel
+   * @param channel capture channel, 0 to 3
+   * @param edges input edges that store the counter
+   * @param interrupt set the capture interrupt flag on a capture
+   */
+  constexpr void setCapture(std::uint32_t channel, captureEdges edges, bool interrupt = false) {
+    std::uint32_t shift = hardware::CCR::CHANNEL_SHIFT(channel);
+    std::uint32_t setting = static_cast<std::uint32_t>(edges) | (interrupt ? hardware::CCR::CAPI : 0u);
+    ctimerPeripheral()->CCR = (ctimerPeripheral()->CCR & ~(hardware::CCR::CAP_MASK << shift)) | (setting << shift);
+  }
+  /**
+   * @brief disable a capture channel
+   * @param channel capture channel, 0 to 3
+   */
+  constexpr void disableCapture(std::uint32_t channel) {
+    ctimerPeripheral()->CCR = ctimerPeripheral()->CCR & ~(hardware::CCR::CAP_MASK << hardware::CCR::CHANNEL_SHIFT(channel));
+  }
+  /**
+   * @brief get the last captured counter value
+   * @param channel capture channel, 0 to 3
+   * @return counter value at the last capture
+   */
+  constexpr std::uint32_t getCapture(std::uint32_t channel) {
+    return ctimerPeripheral()->CR[channel];
+  }
+  /**
+   * @brief get pending interrupt flags
+   * @return flags, use hardware::IR::MRINT and hardware::IR::CRINT to test them
+   */
+  constexpr std::uint32_t getInterrupts() {
+    return ctimerPeripheral()->IR;
+  }
+  /**
+   * @brief clear interrupt flags
+   * @param flags flags to clear
+   */
+  constexpr void clearInterrupts(std::uint32_t flags) {
+    ctimerPeripheral()->IR = flags & hardware::IR::RESERVED_MASK;
+  }
+  /**
+   * @brief clear a pending match DMA request
+   *
+   * The request can already be asserted before the first match, clear it before enabling the DMA channel. The DMA controller
+   * clears the request itself when it services it.
+   *
+   * @param channel match channel, 0 or 1
+   */
+  constexpr void clearDmaRequest(std::uint32_t channel) {
+    ctimerPeripheral()->IR = hardware::IR::MRINT(channel);
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to CTIMER registers
+   */
+  constexpr static hardware::ctimer *ctimerPeripheral() {
+    return reinterpret_cast<hardware::ctimer *>(ctimerAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType ctimerAddress = ctimerAddress_; /**< peripheral address */
+};
+}  // namespace libMcuLL::ctimer
+#endif
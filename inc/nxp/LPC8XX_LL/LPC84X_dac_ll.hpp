@@ -0,0 +1,308 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series DAC low level functions
+ */
+#ifndef LPC84X_DAC_LL_HPP
+#define LPC84X_DAC_LL_HPP
+
+namespace libMcuLL::dac {
+namespace hardware = libMcuHw::dac;
+constexpr inline std::uint32_t maxValue{1023u}; /**< highest output value */
+
+/**
+ * @brief output update modes
+ */
+enum class modes : std::uint32_t {
+  DIRECT = 0,                                                   /**< writes update the output immediately */
+  TIMED = hardware::CTRL::CNT_ENA | hardware::CTRL::DBLBUF_ENA, /**< writes apply at the next counter time-out */
+  DMA = TIMED | hardware::CTRL::DMA_ENA,                        /**< as TIMED, DMA writes the values */
+};
+
+/**
+ * @brief output settling speed
+ */
+enum class speeds : std::uint32_t {
+  FAST = 0,                  /**< 1 us settling time */
+  SLOW = hardware::CR::BIAS, /**< 2.5 us settling time at lower current */
+};
+
+/**
+ * @brief Format an output value as a sample for streaming
+ * @param value output value, 0 to 1023
+ * @param speed output settling speed
+ * @return CR register value
+ */
+constexpr inline std::uint32_t formatSample(std::uint32_t value, speeds speed = speeds::FAST) {
+  return hardware::CR::VALUE(value) | static_cast<std::uint32_t>(speed);
+}
+
+/**
+ * @brief Sine approximation for table generation
+ * @param x angle in radians, 0 to 2 pi
+ * @return sine of x
+ */
+consteval double sine(double x) {
+  constexpr double pi = 3.14159265358979323846;
+  double sign = 1.0;
+  if (x >= pi) {
+    x = x - pi;
+    sign = -1.0;
+  }
+  if (x > pi / 2)
+    x = pi - x;
+  double term = x;
+  double sum = x;
+  for (int power = 3; power < 16; power = power + 2) {
+    term = -term * x * x / (power * (power - 1));
+    sum = sum + term;
+  }
+  return sign * sum;
+}
+
+/**
+ * @brief Generate one period of a sine as samples
+ * @tparam t_samples samples per period
+ * @param amplitude peak deviation from offset
+ * @param offset output value of the center line
+ * @param speed output settling speed
+ * @return formatted samples, starting at the center line going up
+ */
+template <std::size_t t_samples>
+consteval std::array<std::uint32_t, t_samples> makeSineTable(std::uint32_t amplitude = 511, std::uint32_t offset = 512,
+                                                             speeds speed = speeds::FAST) {
+  constexpr double pi = 3.14159265358979323846;
+  std::array<std::uint32_t, t_samples> table{};
+  for (std::size_t index = 0; index < t_samples; index++) {
+    double value = offset + amplitude * sine(2 * pi * static_cast<double>(index) / t_samples);
+    value = value < 0.0 ? 0.0 : (value > maxValue ? maxValue : value);
+    table[index] = formatSample(static_cast<std::uint32_t>(value + 0.5), speed);
+  }
+  return table;
+}
+
+/**
+ * @brief Generate one period of a triangle as samples
+ * @tparam t_samples samples per period
+ * @param amplitude peak deviation from offset
+ * @param offset output value of the center line
+ * @param speed output settling speed
+ * @return formatted samples, starting at the center line going up
+ */
+template <std::size_t t_samples>
+consteval std::array<std::uint32_t, t_samples> makeTriangleTable(std::uint32_t amplitude = 511, std::uint32_t offset = 512,
+                                                                 speeds speed = speeds::FAST) {
+  std::array<std::uint32_t, t_samples> table{};
+  for (std::size_t index = 0; index < t_samples; index++) {
+    double phase = static_cast<double>(index) / t_samples;
+    double shape = phase < 0.25 ? 4 * phase : (phase < 0.75 ? 2 - 4 * phase : 4 * phase - 4);
+    double value = offset + amplitude * shape;
+    value = value < 0.0 ? 0.0 : (value > maxValue ? maxValue : value);
+    table[index] = formatSample(static_cast<std::uint32_t>(value + 0.5), speed);
+  }
+  return table;
+}
+
+/**
+ * @brief DAC low level driver
+ *
+ * Power the DAC in PDRUNCFG, enable its clock, set DACMODE on the output pin and enable its fixed pin function before use.
+ *
+ * @tparam dacAddress_ DAC peripheral address
+ */
+template <libMcu::dacBaseAddress dacAddress_>
+struct dac : libMcu::peripheralBase {
+  /**
+   * @brief setup the DAC in direct mode with the output at zero
+   */
+  constexpr void init() {
+    dacPeripheral()->CTRL = static_cast<std::uint32_t>(modes::DIRECT);
+    dacPeripheral()->CR = formatSample(0);
+  }
+  /**
+   * @brief set the output value, in timed mode it is applied at the next counter time-out
+   * @param value output value, 0 to 1023
+   * @param speed output settling speed
+   */
+  constexpr void write(std::uint32_t value, speeds speed = speeds::FAST) {
+    dacPeripheral()->CR = formatSample(value, speed);
+  }
+  /**
+   * @brief set the update mode
+   * @param mode update mode
+   */
+  constexpr void setMode(modes mode) {
+    dacPeripheral()->CTRL = static_cast<std::uint32_t>(mode);
+  }
+  /**
+   * @brief set the counter time-out period
+   * @param clocks system clocks per time-out, 1 to 65536
+   */
+  constexpr void setSampleClocks(std::uint32_t clocks) {
+    dacPeripheral()->CNTVAL = hardware::CNTVAL::VALUE(clocks - 1);
+  }
+  /**
+   * @brief set the counter time-out rate
+   * @tparam clockConfig MCU clock configuration
+   * @param rate time-outs per second
+   */
+  template <auto &clockConfig>
+  constexpr void setSampleRate(std::uint32_t rate) {
+    setSampleClocks(clockConfig.systemFreq / rate);
+  }
+  /**
+   * @brief check if the counter timed out since the last write
+   * @return true when the DAC is ready for the next value
+   */
+  constexpr bool isRequesting() {
+    return (dacPeripheral()->CTRL & hardware::CTRL::INT_DMA_REQ) != 0;
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to DAC registers
+   */
+  constexpr static hardware::dac *dacPeripheral() {
+    return reinterpret_cast<hardware::dac *>(dacAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType dacAddress = dacAddress_; /**< peripheral address */
+};
+
+/**
+ * @brief Waveform player, the DMA moves a sample to the DAC at every counter time-out
+ *
+ * A table is repeated forever by a descriptor that links to itself, so a constexpr table in flash plays without any CPU
+ * work. A ring is played as two halves that link to each other, each finished half raises the DMA interrupt and can be
+ * refilled while the other half plays. Call isr() from the DMA interrupt handler.
+ *
+ * @tparam dacAddress_ DAC peripheral address
+ * @tparam dmaAddress_ DMA peripheral address
+ * @tparam t_request DMA request of the DAC, dmaRequestSources::dac0 or dmaRequestSources::dac1
+ */
+template <libMcu::dacBaseAddress dacAddress_, libMcu::dmaBaseAddress dmaAddress_, libMcuHw::dma::dmaRequestSources t_request>
+struct stream : libMcu::peripheralBase {
+  /**
+   * @brief setup the DAC and its DMA channel, call dma::init() before this
+   * @param sampleClocks system clocks per sample, 1 to 65536
+   */
+  constexpr void init(std::uint32_t sampleClocks) {
+    dacLL.init();
+    dacLL.setSampleClocks(sampleClocks);
+    dmaLL.setupChannel(channel, libMcuHw::dma::CFG::PERIPHREQEN);
+  }
+  /**
+   * @brief play a table of samples repeatedly
+   * @param table samples made with formatSample, makeSineTable or makeTriangleTable, 1 to 1024 samples
+   * @return libMcu::results::ERROR when the table size is not supported, libMcu::results::STARTED otherwise
+   */
+  libMcu::results play(std::span<const std::uint32_t> table) {
+    if (table.size() == 0 || table.size() > libMcuHw::dma::maxTransfers)
+      return libMcu::results::ERROR;
+    stop();
+    std::uint32_t transferConfig = getTransferConfig(table.size());
+    links[0] = dma::descriptor{transferConfig, getEnd(table), getDestination(), libMcuLL::getAddress(&links[0])};
+    dmaLL.start(channel, transferConfig, links[0].sourceEnd, links[0].destinationEnd, &links[0]);
+    dacLL.setMode(modes::DMA);
+    return libMcu::results::STARTED;
+  }
+  /**
+   * @brief play a ring of samples, the application refills the halves that have been played
+   * @param ring samples made with formatSample, an even amount of 2 to 2048 samples
+   * @return libMcu::results::ERROR when the ring size is not supported, libMcu::results::STARTED otherwise
+   */
+  libMcu::results playRing(std::span<std::uint32_t> ring) {
+    if (ring.size() < 2 || ring.size() % 2 != 0 || ring.size() > 2 * libMcuHw::dma::maxTransfers)
+      return libMcu::results::ERROR;
+    stop();
+    std::size_t half = ring.size() / 2;
+    std::uint32_t transferConfig = getTransferConfig(half) | libMcuHw::dma::XFERCFG::SETINTA;
+    links[0] = dma::descriptor{transferConfig, getEnd(ring.first(half)), getDestination(), libMcuLL::getAddress(&links[1])};
+    links[1] = dma::descriptor{transferConfig, getEnd(ring.last(half)), getDestination(), libMcuLL::getAddress(&links[0])};
+    ringBuffer = ring;
+    playedHalves = 0;
+    consumedHalves = 0;
+    dmaLL.clearInterruptsA(1u << channel);
+    dmaLL.enableInterrupts(1u << channel);
+    dmaLL.start(channel, transferConfig, links[0].sourceEnd, links[0].destinationEnd, &links[1]);
+    dacLL.setMode(modes::DMA);
+    return libMcu::results::STARTED;
+  }
+  /**
+   * @brief check if a ring half has been played and can be refilled
+   * @return true when a half is free
+   */
+  bool isHalfFree() {
+    return playedHalves != consumedHalves;
+  }
+  /**
+   * @brief get the ring half that was played last, refill it before the other half finishes
+   * @return free half of the ring
+   */
+  std::span<std::uint32_t> getFreeHalf() {
+    consumedHalves = playedHalves;
+    std::size_t half = ringBuffer.size() / 2;
+    return (consumedHalves & 1u) ? ringBuffer.first(half) : ringBuffer.last(half);
+  }
+  /**
+   * @brief stop playing, the output keeps the last sample
+   */
+  void stop() {
+    dacLL.setMode(modes::DIRECT);
+    dmaLL.disableInterrupts(1u << channel);
+    dmaLL.stop(channel);
+  }
+  /**
+   * @brief DMA interrupt service routine, counts the played ring halves of this stream
+   */
+  void isr() {
+    if (dmaLL.getInterruptsA() & (1u << channel)) {
+      dmaLL.clearInterruptsA(1u << channel);
+      playedHalves = playedHalves + 1;
+    }
+  }
+
+ private:
+  /**
+   * @brief get the transfer configuration for a block of samples
+   *
+   * CLRTRIG is left clear, the software trigger set by dma::start stays set while the linked descriptors reload.
+   *
+   * @param count amount of samples
+   * @return XFERCFG value
+   */
+  static constexpr std::uint32_t getTransferConfig(std::size_t count) {
+    return libMcuHw::dma::XFERCFG::CFGVALID | libMcuHw::dma::XFERCFG::RELOAD | libMcuHw::dma::XFERCFG::WIDTH_32 |
+           libMcuHw::dma::XFERCFG::SRCINC_1 | libMcuHw::dma::XFERCFG::DSTINC_NONE |
+           libMcuHw::dma::XFERCFG::XFERCOUNT(static_cast<std::uint32_t>(count));
+  }
+  /**
+   * @brief get the address of the last sample of a block
+   * @param samples block of samples
+   * @return bus address
+   */
+  static std::uint32_t getEnd(std::span<const std::uint32_t> samples) {
+    return libMcuLL::getAddress(&samples.back());
+  }
+  /**
+   * @brief get the address the samples are written to
+   * @return bus address of the DAC CR register
+   */
+  static std::uint32_t getDestination() {
+    return libMcuLL::getAddress(&dac<dacAddress_>::dacPeripheral()->CR);
+  }
+
+  static constexpr std::uint32_t channel = static_cast<std::uint32_t>(t_request); /**< DMA channel paced by the DAC */
+  dac<dacAddress_> dacLL;                                                           /**< DAC */
+  dma::dma<dmaAddress_> dmaLL;                                                      /**< DMA controller */
+  std::array<dma::descriptor, 2> links{};                                           /**< linked descriptors */
+  std::span<std::uint32_t> ringBuffer{};                                            /**< ring being played */
+  volatile std::uint32_t playedHalves{0};                                           /**< ring halves played */
+  std::uint32_t consumedHalves{0};                                                  /**< ring halves handed out for refill */
+};
+}  // namespace libMcuLL::dac
+#endif
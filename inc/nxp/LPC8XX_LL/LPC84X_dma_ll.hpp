@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series DMA low level functions
+ */
+#ifndef LPC84X_DMA_LL_HPP
+#define LPC84X_DMA_LL_HPP
+
+namespace libMcuLL::dma {
+namespace hardware = libMcuHw::dma;
+
+/**
+ * @brief Transfer descriptor
+ *
+ * The descriptor table entries leave transferConfig unused, linked descriptors use it as the transfer configuration that is
+ * loaded with them. Linked descriptors need to stay valid while the channel runs.
+ */
+struct alignas(16) descriptor {
+  std::uint32_t transferConfig; /**< XFERCFG value for linked descriptors */
+  std::uint32_t sourceEnd;      /**< address of the last source transfer */
+  std::uint32_t destinationEnd; /**< address of the last destination transfer */
+  std::uint32_t next;           /**< address of the linked descriptor, 0 for none */
+};
+
+/**
+ * @brief DMA controller low level driver
+ *
+ * The descriptor table is shared by all instances with the same address, so every driver that uses DMA can have its own
+ * instance. Channel N is paced by peripheral DMA request N, see libMcuHw::dma::dmaRequestSources.
+ *
+ * @tparam dmaAddress_ DMA peripheral address
+ */
+template <libMcu::dmaBaseAddress dmaAddress_>
+struct dma : libMcu::peripheralBase {
+  /**
+   * @brief setup the descriptor table and enable the DMA controller
+   */
+  constexpr void init() {
+    dmaPeripheral()->SRAMBASE = libMcuLL::getAddress(descriptors.data());
+    dmaPeripheral()->CTRL = hardware::CTRL::ENABLE;
+  }
+  /**
+   * @brief configure a channel
+   * @param channel DMA channel, 0 to 24
+   * @param config CFG register value
+   */
+  constexpr void setupChannel(std::uint32_t channel, std::uint32_t config) {
+    dmaPeripheral()->CHANNEL[channel].CFG = config & hardware::CFG::RESERVED_MASK;
+  }
+  /**
+   * @brief start a transfer on a channel
+   *
+   * A channel only transfers when it is triggered. Channels without hardware triggering are triggered by software here, then
+   * the peripheral request paces the transfers. The trigger stays set across linked descriptors as long as they leave CLRTRIG
+   * clear. Channels with hardware triggering wait for their trigger.
+   *
+   * @param channel DMA channel, 0 to 24
+   * @param transferConfig XFERCFG value, include CFGVALID
+   * @param sourceEnd address of the last source transfer
+   * @param destinationEnd address of the last destination transfer
+   * @param next descriptor to continue with when transferConfig has RELOAD set
+   */
+  constexpr void start(std::uint32_t channel, std::uint32_t transferConfig, std::uint32_t sourceEnd,
+                       std::uint32_t destinationEnd, const descriptor *next = nullptr) {
+    descriptors[channel] = descriptor{0, sourceEnd, destinationEnd, next == nullptr ? 0u : libMcuLL::getAddress(next)};
+    if ((dmaPeripheral()->CHANNEL[channel].CFG & hardware::CFG::HWTRIGEN) == 0)
+      transferConfig = transferConfig | hardware::XFERCFG::SWTRIG;
+    dmaPeripheral()->COMMON[0].ENABLESET = 1u << channel;
+    dmaPeripheral()->CHANNEL[channel].XFERCFG = transferConfig & hardware::XFERCFG::RESERVED_MASK;
+  }
+  /**
+   * @brief stop a channel, aborts a transfer in progress
+   * @param channel DMA channel, 0 to 24
+   */
+  constexpr void stop(std::uint32_t channel) {
+    dmaPeripheral()->COMMON[0].ENABLECLR = 1u << channel;
+    while (dmaPeripheral()->COMMON[0].BUSY & (1u << channel))
+      ;
+    dmaPeripheral()->COMMON[0].ABORT = 1u << channel;
+  }
+  /**
+   * @brief check if a channel has a transfer in progress or pending
+   * @param channel DMA channel, 0 to 24
+   * @return true when active
+   */
+  constexpr bool isActive(std::uint32_t channel) {
+    return (dmaPeripheral()->COMMON[0].ACTIVE & (1u << channel)) != 0;
+  }
+  /**
+   * @brief enable the interrupts of channels
+   * @param channels bit N enables channel N
+   */
+  constexpr void enableInterrupts(std::uint32_t channels) {
+    dmaPeripheral()->COMMON[0].INTENSET = channels;
+  }
+  /**
+   * @brief disable the interrupts of channels
+   * @param channels bit N disables channel N
+   */
+  constexpr void disableInterrupts(std::uint32_t channels) {
+    dmaPeripheral()->COMMON[0].INTENCLR = channels;
+  }
+  /**
+   * @brief get the channels with interrupt flag A set
+   * @return bit N set for channel N
+   */
+  constexpr std::uint32_t getInterruptsA() {
+    return dmaPeripheral()->COMMON[0].INTA;
+  }
+  /**
+   * @brief clear interrupt flag A of channels
+   * @param channels bit N clears channel N
+   */
+  constexpr void clearInterruptsA(std::uint32_t channels) {
+    dmaPeripheral()->COMMON[0].INTA = channels;
+  }
+  /**
+   * @brief get the channels with interrupt flag B set
+   * @return bit N set for channel N
+   */
+  constexpr std::uint32_t getInterruptsB() {
+    return dmaPeripheral()->COMMON[0].INTB;
+  }
+  /**
+   * @brief clear interrupt flag B of channels
+   * @param channels bit N clears channel N
+   */
+  constexpr void clearInterruptsB(std::uint32_t channels) {
+    dmaPeripheral()->COMMON[0].INTB = channels;
+  }
+  /**
+   * @brief get the channels with a transfer error
+   * @return bit N set for channel N
+   */
+  constexpr std::uint32_t getErrors() {
+    return dmaPeripheral()->COMMON[0].ERRINT;
+  }
+  /**
+   * @brief clear transfer errors of channels
+   * @param channels bit N clears channel N
+   */
+  constexpr void clearErrors(std::uint32_t channels) {
+    dmaPeripheral()->COMMON[0].ERRINT = channels;
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to DMA registers
+   */
+  constexpr static hardware::dma *dmaPeripheral() {
+    return reinterpret_cast<hardware::dma *>(dmaAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType dmaAddress = dmaAddress_; /**< peripheral address */
+  alignas(hardware::SRAMBASE::ALIGNMENT) static inline std::array<descriptor, hardware::channelCount> descriptors{}; /**< table */
+};
+}  // namespace libMcuLL::dma
+#endif
@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series fast initialization memory low level functions
+ *
+ * The boot ROM applies the FAIM contents before the application starts, pins get their pull modes directly after reset
+ * instead of after the IOCON setup code has run. FAIM only sets pull modes, all pins are still inputs at boot. An output that
+ * has to stay inactive until the application drives it gets a pulldown or pullup to its inactive level.
+ */
+#ifndef LPC84X_FAIM_LL_HPP
+#define LPC84X_FAIM_LL_HPP
+
+#include <initializer_list>
+
+namespace libMcuLL::faim {
+namespace hardware = libMcuHw::faim;
+
+/**
+ * @brief Clock setting the boot ROM starts the application with
+ */
+enum class bootClocks : std::uint32_t {
+  FRO_12MHZ = 0u,                              /**< 12 MHz FRO */
+  LOW_POWER = hardware::WORD0::LOW_POWER_BOOT, /**< 1.5 MHz low power FRO setting */
+};
+
+/**
+ * @brief Boot pull mode of a pin
+ */
+struct pinPull {
+  std::uint8_t port;     /**< GPIO port index */
+  std::uint8_t pin;      /**< GPIO pin index */
+  iocon::pullModes mode; /**< pull mode at boot */
+};
+
+/**
+ * @brief FAIM contents to program
+ */
+struct image {
+  std::array<std::uint32_t, hardware::wordCount> values; /**< word contents, only the bits set in masks are used */
+  std::array<std::uint32_t, hardware::wordCount> masks;  /**< bits set by this image, other bits keep their contents */
+  bool valid;                                            /**< every pin exists and has a single pull mode */
+};
+
+/**
+ * @brief Boot pull mode of a pin
+ * @tparam PIN pin type
+ * @param pin instance of the pin type
+ * @param mode pull mode at boot
+ * @return pull mode entry for encode
+ */
+template <typename PIN>
+consteval pinPull pull([[maybe_unused]] const PIN &pin, iocon::pullModes mode) {
+  static_assert(PIN::typeFlags == libMcuHw::pinTypeFlags::NORMAL, "only normal pins have a boot pull mode");
+  return pinPull{PIN::gpioPortIndex, PIN::gpioPinIndex, mode};
+}
+
+/**
+ * @brief Convert a pull mode to its FAIM encoding
+ * @param mode pull mode
+ * @return FAIM pull mode
+ */
+constexpr inline std::uint32_t toFaimMode(iocon::pullModes mode) {
+  switch (mode) {
+    case iocon::pullModes::PULLDOWN:
+      return hardware::PIN::PULLDOWN;
+    case iocon::pullModes::PULLUP:
+      return hardware::PIN::PULLUP;
+    case iocon::pullModes::REPEATER:
+      return hardware::PIN::REPEATER;
+    default:
+      return hardware::PIN::INACTIVE;
+  }
+}
+
+/**
+ * @brief Encode a boot configuration to FAIM contents
+ *
+ * Only the boot clock and the listed pins are set, the other bits keep what is programmed in FAIM. Listing a pin twice with
+ * the same pull mode is allowed, with different pull modes the result is invalid. Check it with
+ * `static_assert(contents.valid)`.
+ *
+ * @param clock boot clock setting
+ * @param pulls pull modes of pins, created with pull
+ * @return FAIM contents
+ */
+consteval image encode(bootClocks clock, std::initializer_list<pinPull> pulls) {
+  image result{{}, {}, true};
+  result.values[0] = static_cast<std::uint32_t>(clock);
+  result.masks[0] = hardware::WORD0::LOW_POWER_BOOT;
+  for (const pinPull &entry : pulls) {
+    std::uint32_t word = hardware::PIN::WORD(entry.port, entry.pin);
+    std::uint32_t mask = hardware::PIN::MODE(entry.pin, hardware::PIN::MODE_MASK);
+    std::uint32_t value = hardware::PIN::MODE(entry.pin, toFaimMode(entry.mode));
+    if ((entry.pin >= hardware::pinsPerPort) || (word >= hardware::wordCount)) {
+      result.valid = false;
+      continue;
+    }
+    if ((result.masks[word] & mask) && ((result.values[word] & mask) != value))
+      result.valid = false;
+    result.values[word] |= value;
+    result.masks[word] |= mask;
+  }
+  return result;
+}
+
+/**
+ * @brief Fast initialization memory low level driver
+ *
+ * FAIM is read and written through the IAP routines of the boot ROM. It has a limited write endurance, program only writes
+ * the words that change, so calling it at every boot does not wear FAIM.
+ *
+ * @tparam t_entry IAP entry, iap::romEntry on target
+ */
+template <typename t_entry = iap::romEntry>
+struct faim {
+  /**
+   * @brief read a FAIM word
+   * @param index word index, below hardware::wordCount
+   * @param word word contents
+   * @return NO_ERROR on success, INVALID_ADDRESS or ERROR otherwise
+   */
+  libMcu::results readWord(std::uint32_t index, std::uint32_t &word) {
+    return iap::toResult(iapLL.readFaimPage(index, word));
+  }
+  /**
+   * @brief write a FAIM word, takes effect at the next boot
+   * @param index word index, below hardware::wordCount
+   * @param word word contents
+   * @return NO_ERROR on success, INVALID_ADDRESS or ERROR otherwise
+   */
+  libMcu::results writeWord(std::uint32_t index, std::uint32_t word) {
+    return iap::toResult(iapLL.writeFaimPage(index, word));
+  }
+  /**
+   * @brief check if FAIM holds the contents of an image
+   * @param contents image to compare with
+   * @return true when all bits of the image are programmed
+   */
+  bool matches(const image &contents) {
+    for (std::uint32_t index = 0; index < hardware::wordCount; index++) {
+      std::uint32_t word;
+      if (contents.masks[index] == 0)
+        continue;
+      if ((readWord(index, word) != libMcu::results::NO_ERROR) ||
+          ((word & contents.masks[index]) != (contents.values[index] & contents.masks[index])))
+        return false;
+    }
+    return true;
+  }
+  /**
+   * @brief program an image, only words that change are written
+   * @param contents image to program
+   * @return NO_ERROR on success, ERROR for an invalid image or a failed write, INVALID_ADDRESS for a wrong word
+   */
+  libMcu::results program(const image &contents) {
+    if (!contents.valid)
+      return libMcu::results::ERROR;
+    for (std::uint32_t index = 0; index < hardware::wordCount; index++) {
+      std::uint32_t word;
+      if (contents.masks[index] == 0)
+        continue;
+      libMcu::results result = readWord(index, word);
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+      std::uint32_t updated = (word & ~contents.masks[index]) | (contents.values[index] & contents.masks[index]);
+      if (updated == word)
+        continue;
+      result = writeWord(index, updated);
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+    }
+    return libMcu::results::NO_ERROR;
+  }
+
+ private:
+  iap::iap<t_entry> iapLL; /**< IAP */
+};
+}  // namespace libMcuLL::faim
+#endif
@@ -0,0 +1,38 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series input multiplexer low level functions
+ */
+#ifndef LPC84X_INMUX_LL_HPP
+#define LPC84X_INMUX_LL_HPP
+
+namespace libMcuLL::inmux {
+namespace hardware = libMcuHw::inmux;
+template <libMcu::inputMuxBaseAddress inputMuxAddress_>
+struct inmux : libMcu::peripheralBase {
+  /**
+   * @brief select the hardware trigger of a DMA channel
+   * @param dmaChannel DMA channel, 0 to 24
+   * @param source trigger source
+   */
+  constexpr void selectDmaTrigger(std::uint32_t dmaChannel, libMcuHw::dma::dmaTriggerSources source) {
+    inmuxPeripheral()->DMA_ITRIG_INMUX[dmaChannel] =
+      static_cast<std::uint32_t>(source) & hardware::DMA_ITRIG_INMUX::RESERVED_MASK;
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to INMUX registers
+   */
+  constexpr static hardware::inmux *inmuxPeripheral() {
+    return reinterpret_cast<hardware::inmux *>(inputMuxAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType inputMuxAddress = inputMuxAddress_; /**< peripheral address */
+};
+}  // namespace libMcuLL::inmux
+#endif
@@ -61,6 +61,67 @@ enum class i2cmodes : std::uint32_t {
   I2C_FAST = hardware::PIO::I2C_FAST, /**< fast mode plus I2C */
 };
 
+/**
+ * @brief IOCON setting of a pin, for ioconConfig
+ *
+ * @tparam PIN       pin type
+ * @tparam t_mode    pullModes for normal pins, i2cmodes for I2C pins
+ * @tparam t_filter  glitch filter setting
+ * @tparam t_clock   clock source for glitch filter
+ * @tparam t_options additional single bit options to set
+ */
+template <typename PIN, auto t_mode, pinFiltering t_filter = pinFiltering::BYPASS,
+          clockDivider t_clock = clockDivider::IOCONCLKDIV0, std::uint32_t t_options = 0>
+struct pinConfig {
+  static constexpr bool i2c{std::is_same_v<decltype(t_mode), i2cmodes>}; /**< pin is configured with an I2C mode */
+  static_assert(i2c || std::is_same_v<decltype(t_mode), pullModes>, "the mode needs to be a pull mode or an I2C mode");
+  static_assert(i2c ? (PIN::typeFlags & libMcuHw::pinTypeFlags::IOCON_I2C) : (PIN::typeFlags == libMcuHw::pinTypeFlags::NORMAL),
+                "only I2C pins have a i2c mode setup, only normal pins have a pull mode");
+  static constexpr std::uint8_t index{PIN::ioconIndex}; /**< IOCON register index */
+  static constexpr std::uint32_t value{static_cast<std::uint32_t>(t_mode) | static_cast<std::uint32_t>(t_filter) |
+                                       static_cast<std::uint32_t>(t_clock) | t_options}; /**< IOCON register value */
+  static constexpr bool isDefault{value == (i2c ? hardware::PIO::DEFAULT_I2C : hardware::PIO::DEFAULT)}; /**< reset setting */
+};
+
+/**
+ * @brief IOCON register index and value
+ */
+struct pinSetting {
+  std::uint32_t index; /**< IOCON register index */
+  std::uint32_t value; /**< IOCON register value */
+};
+
+/**
+ * @brief IOCON settings of a whole board, folded to a table of register values at compile time
+ *
+ * Pins that keep their reset setting are left out of the table, so apply it with iocon::setup once after reset. Fails to
+ * compile when a pin is configured more than once.
+ *
+ * @tparam PINS pinConfig types of all pins
+ */
+template <typename... PINS>
+struct ioconConfig {
+  static_assert(!libMcu::hasDuplicates(std::array<std::uint8_t, sizeof...(PINS)>{PINS::index...}),
+                "a pin is configured more than once!");
+  static constexpr std::size_t count{(0u + ... + (PINS::isDefault ? 0u : 1u))}; /**< pins that differ from reset */
+  /**
+   * @brief collect the settings of the pins that differ from reset
+   * @return register settings
+   */
+  static consteval std::array<pinSetting, count> makeTable() {
+    std::array<pinSetting, count> result{};
+    std::size_t entry = 0;
+    (
+      [&] {
+        if constexpr (!PINS::isDefault)
+          result[entry++] = pinSetting{PINS::index, PINS::value};
+      }(),
+      ...);
+    return result;
+  }
+  static constexpr std::array<pinSetting, count> table{makeTable()}; /**< register settings to apply */
+};
+
 template <libMcu::ioconBaseAddress ioconAddress_>
 struct iocon : libMcu::peripheralBase {
   /**
@@ -144,6 +205,19 @@ struct iocon : libMcu::peripheralBase {
     static_assert(pin.typeFlags & libMcuHw::pinTypeFlags::IOCON_I2C, "only I2C pins have a i2c mode setup");
     ioconPeripheral()->PIO[pin.ioconIndex] = static_cast<std::uint32_t>(mode);
   }
+  /**
+   * @brief Setup all pins of a board
+   *
+   * Stores the precomputed register values, the registers are not read.
+   *
+   * @tparam PINS   pinConfig types of the configuration
+   * @param config  configuration to apply
+   */
+  template <typename... PINS>
+  constexpr void setup([[maybe_unused]] const ioconConfig<PINS...> &config) {
+    for (const pinSetting &setting : ioconConfig<PINS...>::table)
+      ioconPeripheral()->PIO[setting.index] = setting.value;
+  }
   /**
    * @brief get registers from peripheral
    *
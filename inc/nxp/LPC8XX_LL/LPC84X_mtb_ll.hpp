@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC840 series Micro Trace Buffer low level functions
+ */
+#ifndef LPC84X_MTB_LL_HPP
+#define LPC84X_MTB_LL_HPP
+
+namespace libMcuLL::mtb {
+namespace hardware = libMcuHw::mtb;
+/**
+ * @brief Micro trace buffer, records executed branches into SRAM
+ *
+ * The trace is written to SRAM starting at the address reported by getBase. Reserve that part of SRAM in the linker script, the
+ * trace overwrites anything placed there. Bracket a profiling zone with start and stop to capture its instruction flow.
+ *
+ * @tparam mtbAddress_ base MTB peripheral address
+ */
+template <libMcu::mtbBaseAddress const &mtbAddress_>
+struct mtb : libMcu::peripheralBase {
+  /**
+   * @brief start tracing from the beginning of the trace buffer
+   * @param sizeMask trace buffer size is 2^(sizeMask+4) bytes
+   */
+  constexpr void start(std::uint32_t sizeMask) {
+    mtbPeripheral()->POSITION = 0u;
+    mtbPeripheral()->MASTER = hardware::MASTER::EN | hardware::MASTER::MASK(sizeMask);
+  }
+  /**
+   * @brief stop tracing, the trace buffer keeps its contents
+   */
+  constexpr void stop() {
+    mtbPeripheral()->MASTER = mtbPeripheral()->MASTER & ~hardware::MASTER::EN;
+  }
+  /**
+   * @brief continue tracing where it was stopped
+   */
+  constexpr void resume() {
+    mtbPeripheral()->MASTER = mtbPeripheral()->MASTER | hardware::MASTER::EN;
+  }
+  /**
+   * @brief stop tracing automatically when the trace pointer reaches a position
+   * @param position trace pointer offset to stop at, must be 8 byte aligned
+   */
+  constexpr void setWatermark(std::uint32_t position) {
+    mtbPeripheral()->FLOW = hardware::FLOW::WATERMARK(position) | hardware::FLOW::AUTOSTOP;
+  }
+  /**
+   * @brief disable automatic stopping on the watermark
+   */
+  constexpr void clearWatermark() {
+    mtbPeripheral()->FLOW = 0u;
+  }
+  /**
+   * @brief get the trace pointer
+   * @return offset of the next trace packet from the trace buffer base
+   */
+  constexpr std::uint32_t getPosition() {
+    return mtbPeripheral()->POSITION & hardware::POSITION::POINTER_MASK;
+  }
+  /**
+   * @brief check if the trace buffer wrapped around
+   * @return true if older trace packets got overwritten
+   */
+  constexpr bool isWrapped() {
+    return (mtbPeripheral()->POSITION & hardware::POSITION::WRAP) != 0;
+  }
+  /**
+   * @brief get the SRAM address of the trace buffer
+   * @return trace buffer base address
+   */
+  constexpr std::uint32_t getBase() {
+    return mtbPeripheral()->BASE;
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to peripheral
+   */
+  static hardware::mtb *mtbPeripheral() {
+    return reinterpret_cast<hardware::mtb *>(mtbAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType mtbAddress = mtbAddress_; /**< peripheral address */
+};
+}  // namespace libMcuLL::mtb
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC84X series pin interrupt and pattern match low level functions
+ */
+#ifndef LPC84X_PININT_LL_HPP
+#define LPC84X_PININT_LL_HPP
+
+namespace libMcuLL::pinint {
+namespace hardware = libMcuHw::pinint;
+
+/**
+ * @brief pin interrupt edges
+ */
+enum class edges : std::uint32_t {
+  RISING = 1,  /**< rising edge */
+  FALLING = 2, /**< falling edge */
+  BOTH = 3,    /**< rising and falling edge */
+};
+
+/**
+ * @brief pin interrupt active levels
+ */
+enum class levels : std::uint32_t {
+  LOW,  /**< active low */
+  HIGH, /**< active high */
+};
+
+/**
+ * @brief Pin interrupts and pattern match engine
+ *
+ * The pins are connected to the channels with syscon::selectPinInterrupt.
+ *
+ * @tparam pinintAddress_ pin interrupt peripheral address
+ */
+template <libMcu::pinintBaseAddress pinintAddress_>
+struct pinint : libMcu::peripheralBase {
+  /**
+   * @brief enable an edge sensitive pin interrupt
+   * @param channel pin interrupt channel, 0 to 7
+   * @param edge edges that trigger the interrupt
+   */
+  constexpr void enableEdge(std::uint32_t channel, edges edge) {
+    std::uint32_t channelBit = 1u << channel;
+    pinintPeripheral()->ISEL = pinintPeripheral()->ISEL & ~channelBit;
+    pinintPeripheral()->RISE = channelBit;
+    pinintPeripheral()->FALL = channelBit;
+    if (static_cast<std::uint32_t>(edge) & static_cast<std::uint32_t>(edges::RISING))
+      pinintPeripheral()->SIENR = channelBit;
+    else
+      pinintPeripheral()->CIENR = channelBit;
+    if (static_cast<std::uint32_t>(edge) & static_cast<std::uint32_t>(edges::FALLING))
+      pinintPeripheral()->SIENF = channelBit;
+    else
+      pinintPeripheral()->CIENF = channelBit;
+  }
+  /**
+   * @brief enable a level sensitive pin interrupt
+   * @param channel pin interrupt channel, 0 to 7
+   * @param level active level
+   */
+  constexpr void enableLevel(std::uint32_t channel, levels level) {
+    std::uint32_t channelBit = 1u << channel;
+    pinintPeripheral()->ISEL = pinintPeripheral()->ISEL | channelBit;
+    if (level == levels::HIGH)
+      pinintPeripheral()->SIENF = channelBit;
+    else
+      pinintPeripheral()->CIENF = channelBit;
+    pinintPeripheral()->SIENR = channelBit;
+  }
+  /**
+   * @brief disable a pin interrupt
+   * @param channel pin interrupt channel, 0 to 7
+   */
+  constexpr void disable(std::uint32_t channel) {
+    std::uint32_t channelBit = 1u << channel;
+    pinintPeripheral()->CIENR = channelBit;
+    pinintPeripheral()->CIENF = channelBit;
+  }
+  /**
+   * @brief get the pin interrupt status
+   * @return bit N set when channel N has a pending interrupt
+   */
+  constexpr std::uint32_t getStatus() {
+    return pinintPeripheral()->IST;
+  }
+  /**
+   * @brief get detected rising edges
+   * @return bit N set when channel N saw a rising edge
+   */
+  constexpr std::uint32_t getRisingEdges() {
+    return pinintPeripheral()->RISE;
+  }
+  /**
+   * @brief get detected falling edges
+   * @return bit N set when channel N saw a falling edge
+   */
+  constexpr std::uint32_t getFallingEdges() {
+    return pinintPeripheral()->FALL;
+  }
+  /**
+   * @brief clear detected edges and the interrupt status of edge sensitive channels
+   * @param channels bit N clears channel N
+   */
+  constexpr void clearEdges(std::uint32_t channels) {
+    pinintPeripheral()->RISE = channels;
+    pinintPeripheral()->FALL = channels;
+    pinintPeripheral()->IST = channels;
+  }
+  /**
+   * @brief switch the pin interrupts to a compiled pattern match expression
+   *
+   * Each product term raises the pin interrupt of the slice it ends in, see libMcuHw::patternMatch::config::endpoints.
+   *
+   * @tparam pattern compiled expression, see libMcuHw::patternMatch::compile
+   * @param wakeEvent also drive the RXEV signal of the core on a match, this wakes a WFE
+   */
+  template <auto &pattern>
+  constexpr void startPattern(bool wakeEvent = false) {
+    static_assert(pattern.valid, "pattern does not fit in the bit slices!");
+    pinintPeripheral()->PMCTRL = 0;
+    pinintPeripheral()->PMCFG = pattern.pmcfg;
+    pinintPeripheral()->PMSRC = pattern.pmsrc;
+    pinintPeripheral()->PMCTRL =
+      libMcuHw::patternMatch::PMCTRL_SEL_PMATCH | (wakeEvent ? libMcuHw::patternMatch::PMCTRL_ENA_RXEV : 0u);
+  }
+  /**
+   * @brief clear the sticky edge detection of a running pattern
+   * @tparam pattern compiled expression that is running
+   */
+  template <auto &pattern>
+  constexpr void rearmPattern() {
+    pinintPeripheral()->PMSRC = pattern.pmsrc;
+  }
+  /**
+   * @brief stop pattern matching and return to normal pin interrupts
+   */
+  constexpr void stopPattern() {
+    pinintPeripheral()->PMCTRL = 0;
+  }
+  /**
+   * @brief get the product terms that currently match
+   * @return bit N set when the product term ending in slice N matches
+   */
+  constexpr std::uint32_t getPatternMatches() {
+    return libMcuHw::patternMatch::PMCTRL_PMAT(pinintPeripheral()->PMCTRL);
+  }
+  /**
+   * @brief get registers from peripheral
+   * @return return pointer to pin interrupt registers
+   */
+  constexpr static hardware::pinint *pinintPeripheral() {
+    return reinterpret_cast<hardware::pinint *>(pinintAddress);
+  }
+
+ private:
+  static constexpr libMcu::hwAddressType pinintAddress = pinintAddress_; /**< peripheral address */
+};
+}  // namespace libMcuLL::pinint
+#endif
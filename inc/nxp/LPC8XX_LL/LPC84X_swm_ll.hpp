@@ -12,6 +12,119 @@
 
 namespace libMcuLL::swm {
 namespace hardware = libMcuHw::swm;
+
+/**
+ * @brief Assignment of a function to a pin, for swmConfig
+ *
+ * @tparam PIN  pin type to assign the function to
+ * @tparam FUNC function type to assign to the pin
+ */
+template <typename PIN, typename FUNC>
+struct assign {
+  /**
+   * @brief check if the function can be assigned to the pin, fixed functions have a single pin
+   * @return true when available
+   */
+  static consteval bool isAvailable() {
+    if constexpr (FUNC::type == hardware::pinFunctionTypes::MOVABLE)
+      return true;
+    else
+      return PIN::pio == FUNC::pio;
+  }
+  static_assert(isAvailable(), "this function is not available on this pin!");
+  static constexpr hardware::pinFunctionTypes type{FUNC::type}; /**< function type */
+  static constexpr std::uint32_t pio{PIN::pio};                 /**< pin the function is assigned to */
+  /**
+   * @brief PINASSIGN register index or PINENABLE register number of the function
+   * @return register index
+   */
+  static consteval std::uint32_t index() {
+    if constexpr (FUNC::type == hardware::pinFunctionTypes::MOVABLE)
+      return FUNC::index;
+    else
+      return FUNC::type == hardware::pinFunctionTypes::FIXED0 ? 0u : 1u;
+  }
+  /**
+   * @brief bits of the function in its register
+   * @return field mask
+   */
+  static consteval std::uint32_t mask() {
+    if constexpr (FUNC::type == hardware::pinFunctionTypes::MOVABLE)
+      return 0xFFu << FUNC::shift;
+    else
+      return static_cast<std::uint32_t>(FUNC::mask);
+  }
+  /**
+   * @brief PINASSIGN field value of a movable function
+   * @return field value, 0 for fixed functions
+   */
+  static consteval std::uint32_t value() {
+    if constexpr (FUNC::type == hardware::pinFunctionTypes::MOVABLE)
+      return static_cast<std::uint32_t>(PIN::pio) << FUNC::shift;
+    else
+      return 0u;
+  }
+};
+
+/**
+ * @brief Switch matrix routing of a whole board, folded to register values at compile time
+ *
+ * Fails to compile when a function is assigned twice or a pin gets more than one function. Apply it with swm::setup, that
+ * writes every affected PINASSIGN and PINENABLE register once.
+ *
+ * @tparam ASSIGNS assign types of all functions
+ */
+template <typename... ASSIGNS>
+struct swmConfig {
+  static constexpr std::size_t assignCount{std::extent_v<decltype(hardware::swm::PINASSIGNS)>}; /**< PINASSIGN registers */
+  /**
+   * @brief check if a function is assigned more than once
+   * @return true when assigned more than once
+   */
+  static consteval bool hasFunctionConflict() {
+    constexpr std::array<hardware::pinFunctionTypes, sizeof...(ASSIGNS)> types{ASSIGNS::type...};
+    constexpr std::array<std::uint32_t, sizeof...(ASSIGNS)> indices{ASSIGNS::index()...};
+    constexpr std::array<std::uint32_t, sizeof...(ASSIGNS)> masks{ASSIGNS::mask()...};
+    for (std::size_t first = 0; first < sizeof...(ASSIGNS); first++) {
+      for (std::size_t second = first + 1; second < sizeof...(ASSIGNS); second++) {
+        if (types[first] == types[second] && indices[first] == indices[second] && (masks[first] & masks[second]))
+          return true;
+      }
+    }
+    return false;
+  }
+  /**
+   * @brief fold the movable functions to PINASSIGN masks or values
+   * @param values true for the register values, false for the masks of the assigned fields
+   * @return value or mask of every PINASSIGN register
+   */
+  static consteval std::array<std::uint32_t, assignCount> foldAssigns(bool values) {
+    std::array<std::uint32_t, assignCount> result{};
+    (
+      [&] {
+        if constexpr (ASSIGNS::type == hardware::pinFunctionTypes::MOVABLE)
+          result[ASSIGNS::index()] |= values ? ASSIGNS::value() : ASSIGNS::mask();
+      }(),
+      ...);
+    return result;
+  }
+  /**
+   * @brief fold the fixed functions of a PINENABLE register
+   * @param type FIXED0 or FIXED1
+   * @return bits to clear in the PINENABLE register
+   */
+  static consteval std::uint32_t foldEnables(hardware::pinFunctionTypes type) {
+    return ((ASSIGNS::type == type ? ASSIGNS::mask() : 0u) | ... | 0u);
+  }
+  static_assert(!hasFunctionConflict(), "a function is assigned more than once!");
+  static_assert(!libMcu::hasDuplicates(std::array<std::uint32_t, sizeof...(ASSIGNS)>{ASSIGNS::pio...}),
+                "a pin has more than one function assigned!");
+  static constexpr std::array<std::uint32_t, assignCount> assignMasks{foldAssigns(false)};     /**< assigned PINASSIGN fields */
+  static constexpr std::array<std::uint32_t, assignCount> assignValues{foldAssigns(true)};     /**< PINASSIGN field values */
+  static constexpr std::uint32_t enable0Mask{foldEnables(hardware::pinFunctionTypes::FIXED0)}; /**< PINENABLE0 bits to clear */
+  static constexpr std::uint32_t enable1Mask{foldEnables(hardware::pinFunctionTypes::FIXED1)}; /**< PINENABLE1 bits to clear */
+};
+
 template <libMcu::swmBaseAddress swmAddress_>
 struct swm : libMcu::peripheralBase {
   /**
@@ -53,6 +166,23 @@ struct swm : libMcu::peripheralBase {
     }
   }
 
+  /**
+   * @brief apply a switch matrix configuration
+   *
+   * Every affected register is written once, PINASSIGN registers with all fields assigned are written without reading them.
+   *
+   * @tparam ASSIGNS assign types of the configuration
+   * @param config   configuration to apply
+   */
+  template <typename... ASSIGNS>
+  constexpr void setup([[maybe_unused]] const swmConfig<ASSIGNS...> &config) {
+    setupAssigns<swmConfig<ASSIGNS...>>(std::make_index_sequence<swmConfig<ASSIGNS...>::assignCount>{});
+    if constexpr (swmConfig<ASSIGNS...>::enable0Mask != 0)
+      swmPeripheral()->PINENABLE0 = swmPeripheral()->PINENABLE0 & ~swmConfig<ASSIGNS...>::enable0Mask;
+    if constexpr (swmConfig<ASSIGNS...>::enable1Mask != 0)
+      swmPeripheral()->PINENABLE1 = swmPeripheral()->PINENABLE1 & ~swmConfig<ASSIGNS...>::enable1Mask;
+  }
+
   /**
    * @brief Enable fixed pins in one go
    *
@@ -80,6 +210,31 @@ struct swm : libMcu::peripheralBase {
   }
 
  private:
+  /**
+   * @brief write the affected PINASSIGN registers of a configuration
+   *
+   * @tparam CONFIG    switch matrix configuration
+   * @tparam t_indices PINASSIGN register indices
+   */
+  template <typename CONFIG, std::size_t... t_indices>
+  constexpr void setupAssigns(std::index_sequence<t_indices...>) {
+    (setupAssign<t_indices, CONFIG::assignMasks[t_indices], CONFIG::assignValues[t_indices]>(), ...);
+  }
+  /**
+   * @brief write a PINASSIGN register when it has assigned fields
+   *
+   * @tparam t_index PINASSIGN register index
+   * @tparam t_mask  assigned fields
+   * @tparam t_value values of the assigned fields
+   */
+  template <std::size_t t_index, std::uint32_t t_mask, std::uint32_t t_value>
+  constexpr void setupAssign() {
+    if constexpr (t_mask == 0xFFFF'FFFFu)
+      swmPeripheral()->PINASSIGNS[t_index] = t_value;
+    else if constexpr (t_mask != 0)
+      swmPeripheral()->PINASSIGNS[t_index] = (swmPeripheral()->PINASSIGNS[t_index] & ~t_mask) | t_value;
+  }
+
   static constexpr libMcu::hwAddressType swmAddress = swmAddress_; /**< peripheral address */
 };
 }  // namespace libMcuLL::swm
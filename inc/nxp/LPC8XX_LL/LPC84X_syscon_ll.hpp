@@ -183,6 +183,18 @@ enum class clockOutSources : std::uint32_t {
   WATCHDOG = hardware::CLKOUTSEL::WATCHDOG, /**< Watchdog oscillator clock source */
 };
 
+/**
+ * @brief Capacitive touch clock sources
+ */
+enum class captClockSources : std::uint32_t {
+  FRO = hardware::CAPTCLKSEL::FRO,           /**< FRO clock source */
+  MAIN = hardware::CAPTCLKSEL::MAIN,         /**< Main clock source */
+  SYS_PLL = hardware::CAPTCLKSEL::SYS_PLL,   /**< System PLL clock source */
+  FRO_DIV = hardware::CAPTCLKSEL::FRO_DIV,   /**< FRO divided by 2 clock source */
+  WATCHDOG = hardware::CAPTCLKSEL::WATCHDOG, /**< Watchdog oscillator clock source, keeps running in deep-sleep */
+  NONE = hardware::CAPTCLKSEL::NONE,         /**< No clock */
+};
+
 template <libMcu::sysconBaseAddress sysconAddress_>
 struct syscon : libMcu::peripheralBase {
   /**
@@ -288,6 +300,22 @@ struct syscon : libMcu::peripheralBase {
     sysconPeripheral()->CLKOUTSEL = static_cast<std::uint32_t>(source);
     sysconPeripheral()->CLKOUTDIV = hardware::CLKOUTDIV::DIV(divisor);
   }
+  /**
+   * @brief connect a pin to a pin interrupt channel
+   * @param channel pin interrupt channel, 0 to 7
+   * @param pin pin to connect
+   */
+  template <typename PIN>
+  constexpr void selectPinInterrupt(std::uint32_t channel, PIN &pin) {
+    sysconPeripheral()->PINTSEL[channel] = hardware::PINTSEL::INTPIN(pin.gpioPortIndex * 32u + pin.gpioPinIndex);
+  }
+  /**
+   * @brief select the capacitive touch functional clock
+   * @param source clock source for CAPT
+   */
+  constexpr void selectCaptClock(captClockSources source) {
+    sysconPeripheral()->CAPTCLKSEL = static_cast<std::uint32_t>(source);
+  }
   /**
    * @brief Power up a peripheral
    * @param setting bit setting from powerEnables enum
@@ -308,9 +336,6 @@ struct syscon : libMcu::peripheralBase {
    */
   template <const libMcuHw::clock::mcuClockConfig &config = libMcuHw::clock::defaultClocks>
   constexpr void configureMcuClocks() {
-    // check if the wanted config is possible at all?
-    static_assert(libMcuHw::clock::findClockFrequency(config.inputFreq, config.systemFreq) != 0,
-                  "Unable to find a clock configuration solution");
     // setup clock source
     if constexpr (config.source == libMcuHw::clock::clockInputSources::FRO) {
       // TODO support 24MHz FRO frequency
@@ -331,8 +356,8 @@ struct syscon : libMcu::peripheralBase {
     // TODO: WDT clock source
     selectMainPllClock(mainClockPllSources::PRE);
     // can we achieve the frequency we need without using the PLL?
-    if constexpr (config.mainFreq == config.inputFreq) {
-      setMainClockDivider(config.mainFreq / config.systemFreq);
+    if constexpr (!config.pllUsed) {
+      setMainClockDivider(config.ahbDiv);
     } else {
       if constexpr (config.source == libMcuHw::clock::clockInputSources::FRO) {
         selectPllClock(libMcuLL::syscon::pllClockSources::FRO);
@@ -340,38 +365,81 @@ struct syscon : libMcu::peripheralBase {
         selectPllClock(libMcuLL::syscon::pllClockSources::EXT);
       }
       depowerPeripherals(libMcuLL::syscon::powerOptions::SYSPLL);
-      setSystemPllControl(libMcuHw::clock::findSystemPllMsel(config.inputFreq, config.mainFreq),
-                          static_cast<libMcuLL::syscon::pllPostDivider>(libMcuHw::clock::findSystemPllPsel(config.mainFreq)));
+      setSystemPllControl(config.msel, static_cast<libMcuLL::syscon::pllPostDivider>(config.psel));
       powerPeripherals(libMcuLL::syscon::powerOptions::SYSPLL);
       while (getSystemPllStatus() == 0)
         ;
-      setMainClockDivider(config.mainFreq / config.systemFreq);
+      setMainClockDivider(config.ahbDiv);
       selectMainPllClock(libMcuLL::syscon::mainClockPllSources::SYSPLL);
     }
   }
   /**
    * @brief Configure peripheral clock with configuration settings
+   *
+   * Also sets up the fractional generator when the peripheral is clocked from FRG0 or FRG1.
+   *
    * @tparam &config configuration for this peripheral
    */
   template <const libMcuHw::clock::periClockConfig &config>
   constexpr void configurePeripheralClock() {
-    if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART0) {
-      if constexpr (config.source == libMcuHw::clock::periSource::FRO)
-        sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART0] = hardware::FCLKSEL::FRO;
-      else if constexpr (config.source == libMcuHw::clock::periSource::MAIN)
-        sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART0] = hardware::FCLKSEL::MAIN;
-      else
-        static_assert(false, "Unsupported clock source for UART0!");
-    } else if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART1) {
-      if constexpr (config.source == libMcuHw::clock::periSource::FRO)
-        sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART0] = hardware::FCLKSEL::FRO;
-      else if constexpr (config.source == libMcuHw::clock::periSource::MAIN)
-        sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART0] = hardware::FCLKSEL::MAIN;
-      else
-        static_assert(false, "Unsupported clock source for UART1!");
-    } else
+    std::uint32_t clockSelect;
+    if constexpr (config.source == libMcuHw::clock::periSource::FRO)
+      clockSelect = hardware::FCLKSEL::FRO;
+    else if constexpr (config.source == libMcuHw::clock::periSource::MAIN)
+      clockSelect = hardware::FCLKSEL::MAIN;
+    else if constexpr (config.source == libMcuHw::clock::periSource::FRG0) {
+      configureFractionalGenerator<config>(0);
+      clockSelect = hardware::FCLKSEL::FRG0;
+    } else if constexpr (config.source == libMcuHw::clock::periSource::FRG1) {
+      configureFractionalGenerator<config>(1);
+      clockSelect = hardware::FCLKSEL::FRG1;
+    } else if constexpr (config.source == libMcuHw::clock::periSource::FRO_DIV)
+      clockSelect = hardware::FCLKSEL::FRO_DIV;
+    else if constexpr (config.source == libMcuHw::clock::periSource::NONE)
+      clockSelect = hardware::FCLKSEL::NONE;
+    else
+      static_assert(false, "Unsupported peripheral clock source!");
+    if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART0)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART0] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART1)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART1] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART2)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART2] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::UART3)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::UART3] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::I2C0)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::I2C0] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::I2C1)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::I2C1] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::I2C2)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::I2C2] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::I2C3)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::I2C3] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::SPI0)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::SPI0] = clockSelect;
+    else if constexpr (config.peripheral == libMcuHw::clock::periSelect::SPI1)
+      sysconPeripheral()->FCLKSEL[hardware::FCLKSEL::SPI1] = clockSelect;
+    else
       static_assert(false, "Unknown or unsupported peripheral!");
   }
+  /**
+   * @brief Configure a fractional generator with peripheral clock configuration settings
+   * @tparam &config configuration of a peripheral clocked from this fractional generator
+   * @param frg fractional generator to configure, 0 or 1
+   */
+  template <const libMcuHw::clock::periClockConfig &config>
+  constexpr void configureFractionalGenerator(std::size_t frg) {
+    if constexpr (config.frgSource == libMcuHw::clock::periSource::FRO)
+      sysconPeripheral()->FRG[frg].FRGCLKSEL = hardware::FRGCLKSEL::FRO;
+    else if constexpr (config.frgSource == libMcuHw::clock::periSource::MAIN)
+      sysconPeripheral()->FRG[frg].FRGCLKSEL = hardware::FRGCLKSEL::MAIN;
+    else if constexpr (config.frgSource == libMcuHw::clock::periSource::SYS_PLL)
+      sysconPeripheral()->FRG[frg].FRGCLKSEL = hardware::FRGCLKSEL::SYS_PLL;
+    else
+      static_assert(false, "Unsupported clock source for the fractional generator!");
+    sysconPeripheral()->FRG[frg].FRGDIV = hardware::FRGDIV::DIV_256;
+    sysconPeripheral()->FRG[frg].FRGMULT = hardware::FRGMULT::MULT(config.frgMult);
+  }
 
   /**
    * @brief Get the DEVICE ID
@@ -75,15 +75,7 @@ struct usart : libMcu::peripheralBase {
    */
   template <const libMcuHw::clock::periClockConfig &t_clockConfig>
   constexpr std::uint32_t init(std::uint32_t baudRate) {
-    std::uint32_t peripheralFrequency = getInputClockFreq<t_clockConfig>();
-    // which peripheral address do I have?
-    // select the UART from the configuration structure
-    // read out clock frequency
-    std::uint32_t baudDivider = peripheralFrequency / (baudRate * 16);
-    usartPeripheral()->BRG = baudDivider;
-    usartPeripheral()->CFG = hardware::CFG::ENABLE | static_cast<std::uint32_t>(uartLength::SIZE_8) |
-                             static_cast<std::uint32_t>(uartParity::NONE) | static_cast<std::uint32_t>(uartStop::STOP_1);
-    return peripheralFrequency / 16u / baudDivider;
+    return init<t_clockConfig>(baudRate, uartLength::SIZE_8, uartParity::NONE, uartStop::STOP_1);
   }
   /**
    * @brief Setup USART
@@ -96,11 +88,44 @@ struct usart : libMcu::peripheralBase {
   template <const libMcuHw::clock::periClockConfig &t_clockConfig>
   constexpr std::uint32_t init(std::uint32_t baudRate, uartLength lengthBits, uartParity parity, uartStop stopBits) {
     std::uint32_t peripheralFrequency = getInputClockFreq<t_clockConfig>();
-    std::uint32_t baudDivider = peripheralFrequency / (baudRate * 16);
-    usartPeripheral()->BRG = baudDivider;
+    // round to the nearest divider with the default oversampling of 16
+    std::uint32_t baudDivider = (peripheralFrequency + baudRate * 8u) / (baudRate * 16u);
+    if (baudDivider == 0)
+      baudDivider = 1;
+    usartPeripheral()->OSR = hardware::OSR::OSRVAL(16);
+    usartPeripheral()->BRG = hardware::BRG::BRGVAL(baudDivider);
+    usartPeripheral()->CFG = hardware::CFG::ENABLE | static_cast<std::uint32_t>(lengthBits) | static_cast<std::uint32_t>(parity) |
+                             static_cast<std::uint32_t>(stopBits);
+    return peripheralFrequency / 16u / baudDivider;
+  }
+  /**
+   * @brief Setup USART with oversampling and baud rate divider computed at compile time
+   *
+   * Fails to compile when the baud rate can not be reached within the allowed error. Use a FRG0 or FRG1 clock configuration
+   * with a multiplier from libMcuHw::clock::findUsartFrgMult for baud rates that do not divide the clock.
+   *
+   * @tparam t_clockConfig clock configuration of this peripheral
+   * @tparam t_baudRate Baud rate value
+   * @tparam t_maxError largest acceptable baud rate error in Hz, default is 1%
+   * @param lengthBits bit length of transmissions, see uartLength enum for options
+   * @param parity parity type of transmissions, see uartParity enum for options
+   * @param stopBits Amount of stop bits, see uartStop enum for options
+   * @return std::uint32_t actual baud rate
+   */
+  template <const libMcuHw::clock::periClockConfig &t_clockConfig, std::uint32_t t_baudRate,
+            std::uint32_t t_maxError = t_baudRate / 100>
+  constexpr std::uint32_t init(uartLength lengthBits = uartLength::SIZE_8, uartParity parity = uartParity::NONE,
+                               uartStop stopBits = uartStop::STOP_1) {
+    constexpr libMcuHw::clock::usartBaudSettings settings{libMcuHw::clock::findUsartBaudSettings(
+      t_clockConfig.getBaseFrequency(), t_baudRate, t_clockConfig.getFrgMult(), t_clockConfig.getFrgMult(), t_maxError)};
+    static_assert(settings.brg != 0, "Unable to find a baud rate solution");
+    // rejects clock configurations of other peripherals at compile time
+    getInputClockFreq<t_clockConfig>();
+    usartPeripheral()->OSR = hardware::OSR::OSRVAL(settings.osr);
+    usartPeripheral()->BRG = hardware::BRG::BRGVAL(settings.brg);
     usartPeripheral()->CFG = hardware::CFG::ENABLE | static_cast<std::uint32_t>(lengthBits) | static_cast<std::uint32_t>(parity) |
                              static_cast<std::uint32_t>(stopBits);
-    return peripheralFrequency / 16 / baudDivider;
+    return settings.baudRate;
   }
   /**
    * @brief return uart status
@@ -0,0 +1,350 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series in application programming functions
+ */
+#ifndef LPC8XX_IAP_LL_HPP
+#define LPC8XX_IAP_LL_HPP
+
+namespace libMcuLL::iap {
+constexpr inline std::uint32_t pageSize{64u};                         /**< flash page size in bytes, the smallest erase unit */
+constexpr inline std::uint32_t sectorSize{1024u};                     /**< flash sector size in bytes, the prepare unit */
+constexpr inline std::uint32_t pagesPerSector{sectorSize / pageSize}; /**< pages in a sector */
+
+/**
+ * @brief IAP command codes
+ */
+enum class commands : std::uint32_t {
+  PREPARE = 50u,           /**< prepare sectors for write operation */
+  COPY_RAM_TO_FLASH = 51u, /**< copy RAM to flash */
+  ERASE_SECTORS = 52u,     /**< erase sectors */
+  BLANK_CHECK = 53u,       /**< blank check sectors */
+  READ_PART_ID = 54u,      /**< read part identification */
+  READ_BOOT_VERSION = 55u, /**< read boot code version */
+  COMPARE = 56u,           /**< compare memory areas */
+  READ_UID = 58u,          /**< read unique identification */
+  ERASE_PAGES = 59u,       /**< erase pages */
+  READ_FAIM_PAGE = 80u,    /**< read a fast initialization memory page, LPC84X only */
+  WRITE_FAIM_PAGE = 81u,   /**< write a fast initialization memory page, LPC84X only */
+};
+
+/**
+ * @brief IAP status codes
+ */
+enum class status : std::uint32_t {
+  CMD_SUCCESS = 0u,           /**< command executed successfully */
+  INVALID_COMMAND = 1u,       /**< invalid command */
+  SRC_ADDR_ERROR = 2u,        /**< source address not on a word boundary */
+  DST_ADDR_ERROR = 3u,        /**< destination address not on a correct boundary */
+  SRC_ADDR_NOT_MAPPED = 4u,   /**< source address is not mapped */
+  DST_ADDR_NOT_MAPPED = 5u,   /**< destination address is not mapped */
+  COUNT_ERROR = 6u,           /**< byte count is not an allowed value */
+  INVALID_SECTOR = 7u,        /**< sector or page number is invalid */
+  SECTOR_NOT_BLANK = 8u,      /**< sector is not blank */
+  SECTOR_NOT_PREPARED = 9u,   /**< prepare command was not executed first */
+  COMPARE_ERROR = 10u,        /**< source and destination differ */
+  BUSY = 11u,                 /**< flash programming interface is busy */
+  PARAM_ERROR = 12u,          /**< insufficient amount of parameters or invalid parameter */
+  ADDR_ERROR = 13u,           /**< address not on a word boundary */
+  ADDR_NOT_MAPPED = 14u,      /**< address is not mapped */
+  CMD_LOCKED = 15u,           /**< command is locked */
+  INVALID_CODE = 16u,         /**< unlock code is invalid */
+  INVALID_BAUD_RATE = 17u,    /**< invalid baud rate setting */
+  INVALID_STOP_BIT = 18u,     /**< invalid stop bit setting */
+  CODE_READ_PROTECTION = 19u, /**< code read protection is enabled */
+};
+
+/**
+ * @brief Convert an IAP status to a libMcu result
+ * @param code IAP status
+ * @return NO_ERROR on success, INVALID_ADDRESS for address errors, ERROR otherwise
+ */
+constexpr inline libMcu::results toResult(status code) {
+  switch (code) {
+    case status::CMD_SUCCESS:
+      return libMcu::results::NO_ERROR;
+    case status::SRC_ADDR_ERROR:
+    case status::DST_ADDR_ERROR:
+    case status::SRC_ADDR_NOT_MAPPED:
+    case status::DST_ADDR_NOT_MAPPED:
+    case status::INVALID_SECTOR:
+    case status::ADDR_ERROR:
+    case status::ADDR_NOT_MAPPED:
+      return libMcu::results::INVALID_ADDRESS;
+    default:
+      return libMcu::results::ERROR;
+  }
+}
+
+/**
+ * @brief Entry into the IAP routines of the boot ROM
+ *
+ * Flash cannot be read while it is erased or programmed, so interrupts are disabled during the call and restored afterwards.
+ * The ROM uses the top 32 bytes of RAM, keep the stack below them. A host build can replace this type by a simulation with
+ * the same static functions.
+ */
+struct romEntry {
+  /**
+   * @brief call the ROM entry
+   * @param command command code followed by its parameters
+   * @param result status code followed by the returned values
+   */
+  static void call(std::uint32_t *command, std::uint32_t *result) {
+    using entryFunction = void (*)(std::uint32_t *, std::uint32_t *);
+    std::uint32_t primask = libMcuLL::getPrimask();
+    libMcuLL::disableInterrupts();
+    reinterpret_cast<entryFunction>(entryAddress)(command, result);
+    libMcuLL::setPrimask(primask);
+  }
+  /**
+   * @brief read words from flash
+   * @param address flash address, word aligned
+   * @param destination words to fill
+   */
+  static void read(std::uint32_t address, std::span<std::uint32_t> destination) {
+    const volatile std::uint32_t *flash = reinterpret_cast<const volatile std::uint32_t *>(address);
+    for (std::size_t index = 0; index < destination.size(); index++)
+      destination[index] = flash[index];
+  }
+  static constexpr std::uint32_t entryAddress{0x1FFF'1FF1u}; /**< ROM IAP entry point, thumb mode */
+};
+
+/**
+ * @brief In application programming low level driver
+ *
+ * Erase and copy need the affected sectors prepared first, every successful erase or copy locks them again.
+ *
+ * @tparam t_entry IAP entry, romEntry on target
+ */
+template <typename t_entry = romEntry>
+struct iap {
+  /**
+   * @brief set the system clock frequency the ROM uses for flash timing
+   * @param systemFreq system clock frequency in Hz
+   */
+  constexpr void init(std::uint32_t systemFreq) {
+    clockKhz = systemFreq / 1000u;
+  }
+  /**
+   * @brief prepare sectors for erase or copy
+   * @param startSector first sector
+   * @param endSector last sector, at least startSector
+   * @return IAP status
+   */
+  status prepare(std::uint32_t startSector, std::uint32_t endSector) {
+    return execute({static_cast<std::uint32_t>(commands::PREPARE), startSector, endSector});
+  }
+  /**
+   * @brief erase sectors
+   * @param startSector first sector
+   * @param endSector last sector, at least startSector
+   * @return IAP status
+   */
+  status eraseSectors(std::uint32_t startSector, std::uint32_t endSector) {
+    return execute({static_cast<std::uint32_t>(commands::ERASE_SECTORS), startSector, endSector, clockKhz});
+  }
+  /**
+   * @brief erase pages
+   * @param startPage first page
+   * @param endPage last page, at least startPage
+   * @return IAP status
+   */
+  status erasePages(std::uint32_t startPage, std::uint32_t endPage) {
+    return execute({static_cast<std::uint32_t>(commands::ERASE_PAGES), startPage, endPage, clockKhz});
+  }
+  /**
+   * @brief copy RAM to flash
+   * @param destination flash address, aligned to the amount of bytes
+   * @param source words in RAM, 64, 128, 256, 512 or 1024 bytes
+   * @return IAP status
+   */
+  status copyToFlash(std::uint32_t destination, std::span<const std::uint32_t> source) {
+    return execute({static_cast<std::uint32_t>(commands::COPY_RAM_TO_FLASH), destination, libMcuLL::getAddress(source.data()),
+                    static_cast<std::uint32_t>(source.size_bytes()), clockKhz});
+  }
+  /**
+   * @brief check if sectors are blank
+   * @param startSector first sector
+   * @param endSector last sector, at least startSector
+   * @return CMD_SUCCESS when blank, SECTOR_NOT_BLANK otherwise
+   */
+  status blankCheck(std::uint32_t startSector, std::uint32_t endSector) {
+    return execute({static_cast<std::uint32_t>(commands::BLANK_CHECK), startSector, endSector});
+  }
+  /**
+   * @brief compare flash or RAM with words in RAM
+   * @param destination address to compare, word aligned
+   * @param source words to compare with
+   * @param mismatch offset of the first difference when the result is COMPARE_ERROR
+   * @return IAP status
+   */
+  status compare(std::uint32_t destination, std::span<const std::uint32_t> source, std::uint32_t &mismatch) {
+    status code = execute({static_cast<std::uint32_t>(commands::COMPARE), destination, libMcuLL::getAddress(source.data()),
+                           static_cast<std::uint32_t>(source.size_bytes())});
+    mismatch = results[1];
+    return code;
+  }
+  /**
+   * @brief read the part identification
+   * @param partId part identification number
+   * @return IAP status
+   */
+  status readPartId(std::uint32_t &partId) {
+    status code = execute({static_cast<std::uint32_t>(commands::READ_PART_ID)});
+    partId = results[1];
+    return code;
+  }
+  /**
+   * @brief read the boot code version
+   * @param version boot code version, major in bits 15:8, minor in bits 7:0
+   * @return IAP status
+   */
+  status readBootVersion(std::uint32_t &version) {
+    status code = execute({static_cast<std::uint32_t>(commands::READ_BOOT_VERSION)});
+    version = results[1];
+    return code;
+  }
+  /**
+   * @brief read the unique identification of the device
+   * @param uid unique identification, least significant word first
+   * @return IAP status
+   */
+  status readUid(std::array<std::uint32_t, 4> &uid) {
+    status code = execute({static_cast<std::uint32_t>(commands::READ_UID)});
+    for (std::size_t index = 0; index < uid.size(); index++)
+      uid[index] = results[index + 1];
+    return code;
+  }
+  /**
+   * @brief read a page of the fast initialization memory, LPC84X only
+   * @param page FAIM page, 0 to 7
+   * @param word page contents
+   * @return IAP status
+   */
+  status readFaimPage(std::uint32_t page, std::uint32_t &word) {
+    std::uint32_t contents{0};
+    status code = execute({static_cast<std::uint32_t>(commands::READ_FAIM_PAGE), page, libMcuLL::getAddress(&contents)});
+    word = contents;
+    return code;
+  }
+  /**
+   * @brief write a page of the fast initialization memory, LPC84X only
+   *
+   * FAIM has a limited write endurance, only write pages that change.
+   *
+   * @param page FAIM page, 0 to 7
+   * @param word page contents
+   * @return IAP status
+   */
+  status writeFaimPage(std::uint32_t page, std::uint32_t word) {
+    return execute({static_cast<std::uint32_t>(commands::WRITE_FAIM_PAGE), page, libMcuLL::getAddress(&word)});
+  }
+
+ private:
+  /**
+   * @brief pass a command to the IAP entry
+   * @param command command code followed by its parameters
+   * @return IAP status
+   */
+  status execute(std::array<std::uint32_t, 5> command) {
+    results.fill(0);
+    t_entry::call(command.data(), results.data());
+    return static_cast<status>(results[0]);
+  }
+
+  std::array<std::uint32_t, 5> results{}; /**< results of the last command */
+  std::uint32_t clockKhz{12000u};         /**< system clock frequency in kHz */
+};
+
+/**
+ * @brief Flash writer that collects small writes in a page buffer
+ *
+ * Writes to the same page are merged in RAM and programmed as one page when a write moves to another page or on flush, so a
+ * page is erased and programmed once instead of once per write. Pages whose contents do not change are not programmed at all.
+ *
+ * @tparam t_entry IAP entry, romEntry on target
+ */
+template <typename t_entry = romEntry>
+struct pageWriter {
+  /**
+   * @brief setup the writer
+   * @param systemFreq system clock frequency in Hz
+   */
+  constexpr void init(std::uint32_t systemFreq) {
+    iapLL.init(systemFreq);
+    pageAddress = noPage;
+    dirty = false;
+  }
+  /**
+   * @brief write bytes to flash, the data may still be buffered when this returns
+   * @param address flash address
+   * @param data bytes to write
+   * @return NO_ERROR or the result of programming a previous page
+   */
+  libMcu::results write(std::uint32_t address, std::span<const std::uint8_t> data) {
+    for (std::size_t index = 0; index < data.size(); index++) {
+      std::uint32_t byteAddress = address + static_cast<std::uint32_t>(index);
+      std::uint32_t page = byteAddress & ~(pageSize - 1u);
+      if (page != pageAddress) {
+        libMcu::results result = flush();
+        if (result != libMcu::results::NO_ERROR)
+          return result;
+        load(page);
+      }
+      std::uint32_t offset = byteAddress - pageAddress;
+      std::uint32_t shift = (offset % 4u) * 8u;
+      std::uint32_t word = buffer[offset / 4u];
+      std::uint32_t updated = (word & ~(0xFFu << shift)) | (static_cast<std::uint32_t>(data[index]) << shift);
+      if (updated != word) {
+        buffer[offset / 4u] = updated;
+        dirty = true;
+      }
+    }
+    return libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief program the buffered page when it was changed
+   * @return NO_ERROR on success, INVALID_ADDRESS or ERROR when programming failed
+   */
+  libMcu::results flush() {
+    if (!dirty)
+      return libMcu::results::NO_ERROR;
+    std::uint32_t sector = pageAddress / sectorSize;
+    std::uint32_t page = pageAddress / pageSize;
+    status code = iapLL.prepare(sector, sector);
+    if (code == status::CMD_SUCCESS)
+      code = iapLL.erasePages(page, page);
+    if (code == status::CMD_SUCCESS)
+      code = iapLL.prepare(sector, sector);
+    if (code == status::CMD_SUCCESS)
+      code = iapLL.copyToFlash(pageAddress, buffer);
+    std::uint32_t mismatch;
+    if (code == status::CMD_SUCCESS)
+      code = iapLL.compare(pageAddress, buffer, mismatch);
+    if (code == status::CMD_SUCCESS)
+      dirty = false;
+    return toResult(code);
+  }
+
+ private:
+  /**
+   * @brief fill the buffer with the current page contents
+   * @param page page address
+   */
+  void load(std::uint32_t page) {
+    t_entry::read(page, buffer);
+    pageAddress = page;
+  }
+
+  static constexpr std::uint32_t noPage{0xFFFF'FFFFu}; /**< no page is buffered */
+  iap<t_entry> iapLL;                                  /**< IAP */
+  std::array<std::uint32_t, pageSize / 4u> buffer{};   /**< page contents */
+  std::uint32_t pageAddress{noPage};                   /**< address of the buffered page */
+  bool dirty{false};                                   /**< buffer differs from flash */
+};
+}  // namespace libMcuLL::iap
+#endif
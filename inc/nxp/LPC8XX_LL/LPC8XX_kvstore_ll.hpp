@@ -0,0 +1,388 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series wear levelled key value store in flash
+ *
+ * Records are appended to flash pages, a changed value is written to a new page instead of erasing the old one. Every record
+ * occupies a whole page, so a page is programmed once between erases and a power loss only affects the page being written.
+ * The store is a ring of sectors, the first page of a sector holds its generation, the remaining pages hold records. When the
+ * newest sector is full the next sector is started and the oldest sector is garbage collected by copying its live records to
+ * the newest sector and erasing it. There is always an erased sector left to continue in.
+ */
+#ifndef LPC8XX_KVSTORE_LL_HPP
+#define LPC8XX_KVSTORE_LL_HPP
+
+#include <algorithm>
+
+namespace libMcuLL::kvstore {
+constexpr inline std::uint32_t pageWords{iap::pageSize / 4u};              /**< words in a page */
+constexpr inline std::uint32_t recordsPerSector{iap::pagesPerSector - 1u}; /**< record pages in a sector */
+constexpr inline std::uint32_t headerSize{8u};                             /**< checksum and key/length word of a record */
+constexpr inline std::uint32_t maxValueSize{iap::pageSize - headerSize};   /**< largest value in bytes */
+constexpr inline std::uint32_t sectorMagic{0x3153'564Bu};                  /**< "KVS1", marks a sector in use */
+constexpr inline std::uint32_t deletedLength{0xFFFFu};                     /**< length of a record that removes a key */
+constexpr inline std::uint32_t erasedWord{0xFFFF'FFFFu};                   /**< contents of erased flash */
+
+using page = std::array<std::uint32_t, pageWords>; /**< contents of a flash page */
+
+/**
+ * @brief Software CRC-32 for builds that do not use the CRC engine
+ *
+ * Calculates the same checksum as the CRC engine in CRC-32 mode, records written with either can be read with the other.
+ */
+struct softwareCrc {
+  /**
+   * @brief calculate the reflected CRC-32 of bytes, the CRC used by Ethernet and zlib
+   * @param data bytes to calculate the CRC of
+   * @return CRC-32
+   */
+  constexpr std::uint32_t crc32(std::span<const std::uint8_t> data) {
+    std::uint32_t crc = 0xFFFF'FFFFu;
+    for (std::uint8_t byte : data) {
+      crc = crc ^ byte;
+      for (std::uint32_t bit = 0; bit < 8u; bit++)
+        crc = (crc >> 1) ^ (0xEDB8'8320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+  }
+};
+
+/**
+ * @brief Flash access through the IAP routines of the boot ROM
+ *
+ * The store only erases whole sectors and programs whole pages. A host build replaces this type by a simulated flash array
+ * with the same member functions, see libMcuSim::flash::flashArray.
+ *
+ * @tparam t_entry IAP entry, iap::romEntry on target
+ */
+template <typename t_entry = iap::romEntry>
+struct iapFlash {
+  /**
+   * @brief set the system clock frequency the ROM uses for flash timing
+   * @param systemFreq system clock frequency in Hz
+   */
+  constexpr void init(std::uint32_t systemFreq) {
+    iapLL.init(systemFreq);
+  }
+  /**
+   * @brief check if a sector is erased
+   * @param sector sector number
+   * @return true when erased
+   */
+  bool isBlank(std::uint32_t sector) {
+    return iapLL.blankCheck(sector, sector) == iap::status::CMD_SUCCESS;
+  }
+  /**
+   * @brief erase a sector
+   * @param sector sector number
+   * @return NO_ERROR on success, INVALID_ADDRESS or ERROR otherwise
+   */
+  libMcu::results erase(std::uint32_t sector) {
+    iap::status code = iapLL.prepare(sector, sector);
+    if (code == iap::status::CMD_SUCCESS)
+      code = iapLL.eraseSectors(sector, sector);
+    return iap::toResult(code);
+  }
+  /**
+   * @brief program an erased page and verify it
+   * @param address page address
+   * @param contents page contents
+   * @return NO_ERROR on success, INVALID_ADDRESS or ERROR otherwise
+   */
+  libMcu::results program(std::uint32_t address, const page &contents) {
+    std::uint32_t sector = address / iap::sectorSize;
+    std::uint32_t mismatch;
+    iap::status code = iapLL.prepare(sector, sector);
+    if (code == iap::status::CMD_SUCCESS)
+      code = iapLL.copyToFlash(address, contents);
+    if (code == iap::status::CMD_SUCCESS)
+      code = iapLL.compare(address, contents, mismatch);
+    return iap::toResult(code);
+  }
+  /**
+   * @brief read words from flash
+   * @param address flash address, word aligned
+   * @param destination words to fill
+   */
+  void read(std::uint32_t address, std::span<std::uint32_t> destination) {
+    t_entry::read(address, destination);
+  }
+
+ private:
+  iap::iap<t_entry> iapLL; /**< IAP */
+};
+
+/**
+ * @brief Log structured key value store with an index in RAM
+ *
+ * Keys are numbers below t_maxKeys, the index holds the flash address of the newest record of every key, so lookups do not
+ * search flash. The index is rebuilt by init, which scans the sectors from old to new. Records with a bad checksum, left by a
+ * power loss during programming, are skipped. Garbage collection that was interrupted by a power loss is finished by init.
+ *
+ * @tparam t_firstSector first flash sector of the store, must not overlap the application
+ * @tparam t_sectorCount sectors used by the store, at least 2
+ * @tparam t_maxKeys amount of keys, below recordsPerSector so a new sector holds the live records and the record being written
+ * @tparam t_flash flash access, iapFlash on target
+ * @tparam t_crc checksum calculation, softwareCrc or a CRC engine low level driver
+ */
+template <std::uint32_t t_firstSector, std::uint32_t t_sectorCount, std::uint32_t t_maxKeys, typename t_flash = iapFlash<>,
+          typename t_crc = softwareCrc>
+struct store {
+  static_assert(t_sectorCount >= 2u, "garbage collection needs at least two sectors");
+  static_assert(t_maxKeys < recordsPerSector, "the live records and the record being written need to fit in a new sector");
+  /**
+   * @brief setup flash access and rebuild the index from flash, formats the store when no sector is in use
+   * @param systemFreq system clock frequency in Hz
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written
+   */
+  libMcu::results init(std::uint32_t systemFreq) {
+    flash.init(systemFreq);
+    generations.fill(0);
+    index.fill(noRecord);
+    for (std::uint32_t sector = 0; sector < t_sectorCount; sector++) {
+      std::array<std::uint32_t, 3> header;
+      flash.read(sectorAddress(sector), header);
+      if ((header[0] == sectorMagic) && (header[1] != 0) && (header[1] == ~header[2]))
+        generations[sector] = header[1];
+    }
+    std::uint32_t previous = 0;
+    std::uint32_t sector = oldestSectorAfter(previous);
+    if (sector == noSector)
+      return format();
+    while (sector != noSector) {
+      head = sector;
+      scan(sector);
+      previous = generations[sector];
+      sector = oldestSectorAfter(previous);
+    }
+    std::uint32_t next = (head + 1u) % t_sectorCount;
+    if (generations[next] != 0)
+      return reclaim(next);
+    return libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief erase all sectors and start with an empty store
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written
+   */
+  libMcu::results format() {
+    generations.fill(0);
+    index.fill(noRecord);
+    for (std::uint32_t sector = 0; sector < t_sectorCount; sector++) {
+      if (!flash.isBlank(t_firstSector + sector)) {
+        libMcu::results result = flash.erase(t_firstSector + sector);
+        if (result != libMcu::results::NO_ERROR)
+          return result;
+      }
+    }
+    return open(0, 1);
+  }
+  /**
+   * @brief check if a key has a value
+   * @param key key, below t_maxKeys
+   * @return true when the key has a value
+   */
+  constexpr bool contains(std::uint32_t key) const {
+    return (key < t_maxKeys) && (index[key] != noRecord);
+  }
+  /**
+   * @brief read the value of a key
+   * @param key key, below t_maxKeys
+   * @param value bytes to fill, when too short only the first bytes are filled
+   * @param length length of the stored value
+   * @return NO_ERROR on success, OVERRUN when value is shorter than the stored value, ERROR when the key has no value
+   */
+  libMcu::results read(std::uint32_t key, std::span<std::uint8_t> value, std::uint32_t &length) {
+    if (!contains(key))
+      return libMcu::results::ERROR;
+    flash.read(index[key], buffer);
+    length = buffer[1] >> 16;
+    const std::uint8_t *stored = bytes() + headerSize;
+    std::size_t count = std::min<std::size_t>(length, value.size());
+    std::copy(stored, stored + count, value.begin());
+    return count < length ? libMcu::results::OVERRUN : libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief write the value of a key, nothing is written when the value did not change
+   * @param key key, below t_maxKeys
+   * @param value bytes to store, at most maxValueSize
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written or the arguments are invalid
+   */
+  libMcu::results write(std::uint32_t key, std::span<const std::uint8_t> value) {
+    if ((key >= t_maxKeys) || (value.size() > maxValueSize))
+      return libMcu::results::ERROR;
+    if (contains(key)) {
+      flash.read(index[key], buffer);
+      const std::uint8_t *stored = bytes() + headerSize;
+      if (((buffer[1] >> 16) == value.size()) && std::equal(value.begin(), value.end(), stored))
+        return libMcu::results::NO_ERROR;
+    }
+    return append(key, static_cast<std::uint32_t>(value.size()), value);
+  }
+  /**
+   * @brief remove the value of a key
+   * @param key key, below t_maxKeys
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written or the key is invalid
+   */
+  libMcu::results remove(std::uint32_t key) {
+    if (key >= t_maxKeys)
+      return libMcu::results::ERROR;
+    if (!contains(key))
+      return libMcu::results::NO_ERROR;
+    return append(key, deletedLength, {});
+  }
+
+ private:
+  /**
+   * @brief flash address of a sector of the store
+   * @param sector sector of the store, below t_sectorCount
+   * @return flash address
+   */
+  static constexpr std::uint32_t sectorAddress(std::uint32_t sector) {
+    return (t_firstSector + sector) * iap::sectorSize;
+  }
+  /**
+   * @brief find the sector in use with the lowest generation above a generation
+   * @param generation generation to start after
+   * @return sector of the store, noSector when there is none
+   */
+  constexpr std::uint32_t oldestSectorAfter(std::uint32_t generation) const {
+    std::uint32_t oldest = noSector;
+    for (std::uint32_t sector = 0; sector < t_sectorCount; sector++) {
+      if ((generations[sector] > generation) && ((oldest == noSector) || (generations[sector] < generations[oldest])))
+        oldest = sector;
+    }
+    return oldest;
+  }
+  /**
+   * @brief page buffer as bytes
+   * @return first byte of the buffer
+   */
+  std::uint8_t *bytes() {
+    return reinterpret_cast<std::uint8_t *>(buffer.data());
+  }
+  /**
+   * @brief checksum of the record in the buffer, covers the key/length word and the value
+   * @param length value length, deletedLength for a removal
+   * @return checksum
+   */
+  std::uint32_t checksum(std::uint32_t length) {
+    std::uint32_t size = 4u + (length == deletedLength ? 0u : length);
+    return crcEngine.crc32(std::span<const std::uint8_t>(bytes() + 4u, size));
+  }
+  /**
+   * @brief add the records of a sector to the index
+   *
+   * Updates writeAddress to the first erased page, so the last scanned sector is the one to continue in.
+   *
+   * @param sector sector of the store
+   */
+  void scan(std::uint32_t sector) {
+    writeAddress = sectorAddress(sector + 1u);
+    for (std::uint32_t address = sectorAddress(sector) + iap::pageSize; address < sectorAddress(sector + 1u);
+         address += iap::pageSize) {
+      flash.read(address, buffer);
+      if (std::all_of(buffer.begin(), buffer.end(), [](std::uint32_t word) { return word == erasedWord; })) {
+        writeAddress = address;
+        return;
+      }
+      std::uint32_t key = buffer[1] & 0xFFFFu;
+      std::uint32_t length = buffer[1] >> 16;
+      if ((key < t_maxKeys) && ((length <= maxValueSize) || (length == deletedLength)) && (buffer[0] == checksum(length)))
+        index[key] = length == deletedLength ? noRecord : address;
+    }
+  }
+  /**
+   * @brief start a sector with a generation
+   * @param sector erased sector of the store
+   * @param generation generation of the sector
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written
+   */
+  libMcu::results open(std::uint32_t sector, std::uint32_t generation) {
+    if (!flash.isBlank(t_firstSector + sector)) {
+      libMcu::results result = flash.erase(t_firstSector + sector);
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+    }
+    page header;
+    header.fill(erasedWord);
+    header[0] = sectorMagic;
+    header[1] = generation;
+    header[2] = ~generation;
+    libMcu::results result = flash.program(sectorAddress(sector), header);
+    if (result != libMcu::results::NO_ERROR)
+      return result;
+    generations[sector] = generation;
+    head = sector;
+    writeAddress = sectorAddress(sector) + iap::pageSize;
+    return libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief copy the live records of a sector to the newest sector and erase it
+   * @param sector sector of the store, not the newest
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written
+   */
+  libMcu::results reclaim(std::uint32_t sector) {
+    for (std::uint32_t key = 0; key < t_maxKeys; key++) {
+      if ((index[key] < sectorAddress(sector)) || (index[key] >= sectorAddress(sector + 1u)))
+        continue;
+      if (writeAddress == sectorAddress(head + 1u))
+        return libMcu::results::ERROR;
+      flash.read(index[key], buffer);
+      libMcu::results result = flash.program(writeAddress, buffer);
+      writeAddress = writeAddress + iap::pageSize;
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+      index[key] = writeAddress - iap::pageSize;
+    }
+    generations[sector] = 0;
+    return flash.erase(t_firstSector + sector);
+  }
+  /**
+   * @brief append a record, continues in the next sector and collects garbage when needed
+   * @param key key, below t_maxKeys
+   * @param length value length, deletedLength for a removal
+   * @param value bytes to store
+   * @return NO_ERROR on success, ERROR or INVALID_ADDRESS when flash could not be written
+   */
+  libMcu::results append(std::uint32_t key, std::uint32_t length, std::span<const std::uint8_t> value) {
+    if (writeAddress == sectorAddress(head + 1u)) {
+      std::uint32_t next = (head + 1u) % t_sectorCount;
+      libMcu::results result = open(next, generations[head] + 1u);
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+      std::uint32_t oldest = (next + 1u) % t_sectorCount;
+      if (generations[oldest] != 0)
+        result = reclaim(oldest);
+      if (result != libMcu::results::NO_ERROR)
+        return result;
+      if (writeAddress == sectorAddress(head + 1u))
+        return libMcu::results::ERROR;
+    }
+    buffer.fill(erasedWord);
+    std::copy(value.begin(), value.end(), bytes() + headerSize);
+    buffer[1] = key | (length << 16);
+    buffer[0] = checksum(length);
+    libMcu::results result = flash.program(writeAddress, buffer);
+    writeAddress = writeAddress + iap::pageSize;
+    if (result != libMcu::results::NO_ERROR)
+      return result;
+    index[key] = length == deletedLength ? noRecord : writeAddress - iap::pageSize;
+    return libMcu::results::NO_ERROR;
+  }
+
+  static constexpr std::uint32_t noRecord{0xFFFF'FFFFu};  /**< index entry of a key without value */
+  static constexpr std::uint32_t noSector{0xFFFF'FFFFu};  /**< no sector found */
+  t_flash flash;                                          /**< flash access */
+  t_crc crcEngine;                                        /**< checksum calculation */
+  page buffer{};                                          /**< record being read or written */
+  std::array<std::uint32_t, t_maxKeys> index{};           /**< flash address of the newest record of every key */
+  std::array<std::uint32_t, t_sectorCount> generations{}; /**< generation of every sector, 0 when not in use */
+  std::uint32_t head{0};                                  /**< sector appended to */
+  std::uint32_t writeAddress{0};                          /**< next erased record page */
+};
+}  // namespace libMcuLL::kvstore
+#endif
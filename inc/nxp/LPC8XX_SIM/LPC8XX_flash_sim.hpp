@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series flash host simulation model
+ *
+ * Replaces libMcuLL::kvstore::iapFlash on a host, include after the device header. The flash contents are static, so they
+ * survive destroying the store and creating it again, which is how a reset is simulated.
+ */
+#ifndef LPC8XX_FLASH_SIM_HPP
+#define LPC8XX_FLASH_SIM_HPP
+
+#include <algorithm>
+
+namespace libMcuSim::flash {
+/**
+ * @brief flash array model with page programming, sector erase and power loss injection
+ *
+ * Programming clears bits like NOR flash does. Programming a page twice without erasing it in between is refused, as the
+ * store must never do that.
+ *
+ * @tparam t_size flash size in bytes, a multiple of the sector size
+ */
+template <std::uint32_t t_size>
+struct flashArray {
+  static constexpr std::uint32_t sectors{t_size / libMcuLL::iap::sectorSize}; /**< amount of sectors */
+  static constexpr std::uint32_t pages{t_size / libMcuLL::iap::pageSize};     /**< amount of pages */
+  /**
+   * @brief flash timing setup, not used by the model
+   * @param systemFreq system clock frequency in Hz
+   */
+  constexpr void init([[maybe_unused]] std::uint32_t systemFreq) {}
+  /**
+   * @brief check if a sector is erased
+   * @param sector sector number
+   * @return true when erased
+   */
+  bool isBlank(std::uint32_t sector) {
+    auto first = memory.begin() + sector * wordsPerSector;
+    return std::all_of(first, first + wordsPerSector, [](std::uint32_t word) { return word == erasedWord; });
+  }
+  /**
+   * @brief erase a sector, only erases the first half when power is lost
+   * @param sector sector number
+   * @return NO_ERROR on success, INVALID_ADDRESS for a sector outside the array, ERROR without power
+   */
+  libMcu::results erase(std::uint32_t sector) {
+    if (sector >= sectors)
+      return libMcu::results::INVALID_ADDRESS;
+    std::uint32_t words = wordsWithPower(wordsPerSector);
+    if (words == 0)
+      return libMcu::results::ERROR;
+    std::fill_n(memory.begin() + sector * wordsPerSector, words, erasedWord);
+    std::fill_n(programmed.begin() + sector * libMcuLL::iap::pagesPerSector, words / libMcuLL::kvstore::pageWords, false);
+    erases[sector]++;
+    return words == wordsPerSector ? libMcu::results::NO_ERROR : libMcu::results::ERROR;
+  }
+  /**
+   * @brief program an erased page, only programs the first half when power is lost
+   * @param address page address
+   * @param contents page contents
+   * @return NO_ERROR on success, INVALID_ADDRESS for a wrong address, ERROR when programmed twice or without power
+   */
+  libMcu::results program(std::uint32_t address, const libMcuLL::kvstore::page &contents) {
+    if ((address % libMcuLL::iap::pageSize != 0) || (address >= t_size))
+      return libMcu::results::INVALID_ADDRESS;
+    std::uint32_t page = address / libMcuLL::iap::pageSize;
+    if (programmed[page])
+      return libMcu::results::ERROR;
+    std::uint32_t words = wordsWithPower(libMcuLL::kvstore::pageWords);
+    if (words == 0)
+      return libMcu::results::ERROR;
+    for (std::uint32_t index = 0; index < words; index++)
+      memory[address / 4u + index] &= contents[index];
+    programmed[page] = true;
+    return words == contents.size() ? libMcu::results::NO_ERROR : libMcu::results::ERROR;
+  }
+  /**
+   * @brief read words from flash
+   * @param address flash address, word aligned
+   * @param destination words to fill
+   */
+  void read(std::uint32_t address, std::span<std::uint32_t> destination) {
+    std::copy_n(memory.begin() + address / 4u, destination.size(), destination.begin());
+  }
+  /**
+   * @brief lose power during a later erase or program, it is interrupted halfway and all following ones fail
+   * @param operations erases and programs that still complete
+   */
+  static void losePowerAfter(std::uint32_t operations) {
+    remaining = operations;
+  }
+  /**
+   * @brief restore power, flash operations complete again
+   */
+  static void restorePower() {
+    remaining = unlimited;
+  }
+  /**
+   * @brief erase the whole array and clear the erase counts
+   */
+  static void reset() {
+    memory.fill(erasedWord);
+    programmed.fill(false);
+    erases.fill(0);
+    restorePower();
+  }
+  /**
+   * @brief amount of erases of a sector since the last reset
+   * @param sector sector number
+   * @return erase count
+   */
+  static std::uint32_t getErases(std::uint32_t sector) {
+    return erases[sector];
+  }
+
+ private:
+  /**
+   * @brief count down the operations until power is lost
+   * @param words words the operation changes
+   * @return words changed before power is lost, half of them for the interrupted operation, none after it
+   */
+  static std::uint32_t wordsWithPower(std::uint32_t words) {
+    if (remaining == unlimited)
+      return words;
+    if (remaining == lost)
+      return 0;
+    if (remaining == 0) {
+      remaining = lost;
+      return words / 2u;
+    }
+    remaining--;
+    return words;
+  }
+
+  static constexpr std::uint32_t erasedWord{0xFFFF'FFFFu};                       /**< contents of erased flash */
+  static constexpr std::uint32_t wordsPerSector{libMcuLL::iap::sectorSize / 4u}; /**< words in a sector */
+  static constexpr std::uint32_t unlimited{0xFFFF'FFFFu};                        /**< power is not lost */
+  static constexpr std::uint32_t lost{0xFFFF'FFFEu};                             /**< power was lost */
+  /**
+   * @brief flash contents, erased at startup
+   */
+  static inline std::array<std::uint32_t, t_size / 4u> memory = [] {
+    std::array<std::uint32_t, t_size / 4u> erased;
+    erased.fill(erasedWord);
+    return erased;
+  }();
+  static inline std::array<bool, pages> programmed{};        /**< page programmed since its last erase */
+  static inline std::array<std::uint32_t, sectors> erases{}; /**< erase count of every sector */
+  static inline std::uint32_t remaining{unlimited};          /**< operations until power is lost */
+};
+}  // namespace libMcuSim::flash
+
+#endif
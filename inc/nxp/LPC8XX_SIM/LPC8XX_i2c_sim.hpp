@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series I2C host simulation model
+ */
+#ifndef LPC8XX_I2C_SIM_HPP
+#define LPC8XX_I2C_SIM_HPP
+
+#include <cstddef>
+#include "../../host/host_sim.hpp"
+
+namespace libMcuSim::i2c {
+/**
+ * @brief I2C master model with a single register file target on the bus
+ *
+ * The target behaves like a typical EEPROM or sensor: the first byte written after the address selects the register, further
+ * writes store data and reads return data, both auto incrementing. Other addresses are not acknowledged. Bus events complete
+ * instantly, MSTPENDING is always set.
+ *
+ * @tparam registers I2C register structure of the simulated device
+ * @tparam memorySize amount of registers in the target
+ */
+template <typename registers, std::size_t memorySize>
+struct i2cTarget : peripheralModel {
+  /**
+   * @brief map the I2C registers and attach this model
+   * @param address I2C peripheral base address
+   * @param deviceAddress 7 bit address of the simulated target
+   * @return NO_ERROR when attached, ERROR otherwise
+   */
+  libMcu::results attach(libMcu::hwAddressType address, std::uint8_t deviceAddress) {
+    targetAddress = deviceAddress;
+    return libMcuSim::attach(*this, address, sizeof(registers));
+  }
+  /**
+   * @brief target register contents, can be changed between LL calls, call synchronize after changing them
+   * @return target registers
+   */
+  std::array<std::uint8_t, memorySize>& memory() {
+    synchronize();
+    return targetMemory;
+  }
+  void beforeRead(std::uint32_t offset) override {
+    if (offset == offsetof(registers, STAT)) {
+      setRegister(offset, STAT_MSTPENDING | masterState);
+    } else if ((offset == offsetof(registers, MSTDAT)) && (masterState == STAT_MSTSTATE_RXRDY)) {
+      setRegister(offset, targetMemory[pointer]);
+    }
+  }
+  void afterWrite(std::uint32_t offset) override {
+    if (offset != offsetof(registers, MSTCTL))
+      return;
+    std::uint32_t control = getRegister(offset);
+    if (control & MSTCTL_MSTSTOP) {
+      masterState = STAT_MSTSTATE_IDLE;
+    } else if (control & MSTCTL_MSTSTART) {
+      std::uint32_t addressByte = getRegister(offsetof(registers, MSTDAT));
+      if ((addressByte >> 1) != targetAddress) {
+        masterState = STAT_MSTSTATE_NACK_ADDR;
+      } else if (addressByte & 0x01u) {
+        masterState = STAT_MSTSTATE_RXRDY;
+      } else {
+        masterState = STAT_MSTSTATE_TXRDY;
+        selectRegister = true;
+      }
+    } else if (control & MSTCTL_MSTCONTINUE) {
+      if (masterState == STAT_MSTSTATE_TXRDY) {
+        std::uint8_t data = static_cast<std::uint8_t>(getRegister(offsetof(registers, MSTDAT)));
+        if (selectRegister) {
+          pointer = data % memorySize;
+          selectRegister = false;
+        } else {
+          targetMemory[pointer] = data;
+          pointer = (pointer + 1) % memorySize;
+        }
+      } else if (masterState == STAT_MSTSTATE_RXRDY) {
+        pointer = (pointer + 1) % memorySize;
+      }
+    }
+  }
+
+ private:
+  static constexpr std::uint32_t STAT_MSTPENDING{1u << 0};         /**< LPC800 I2C master pending */
+  static constexpr std::uint32_t STAT_MSTSTATE_IDLE{0u << 1};      /**< LPC800 I2C master idle */
+  static constexpr std::uint32_t STAT_MSTSTATE_RXRDY{1u << 1};     /**< LPC800 I2C master receive ready */
+  static constexpr std::uint32_t STAT_MSTSTATE_TXRDY{2u << 1};     /**< LPC800 I2C master transmit ready */
+  static constexpr std::uint32_t STAT_MSTSTATE_NACK_ADDR{3u << 1}; /**< LPC800 I2C address not acknowledged */
+  static constexpr std::uint32_t MSTCTL_MSTCONTINUE{1u << 0};      /**< LPC800 I2C master continue */
+  static constexpr std::uint32_t MSTCTL_MSTSTART{1u << 1};         /**< LPC800 I2C master start */
+  static constexpr std::uint32_t MSTCTL_MSTSTOP{1u << 2};          /**< LPC800 I2C master stop */
+
+  std::array<std::uint8_t, memorySize> targetMemory{}; /**< target registers */
+  std::uint8_t targetAddress{0};                        /**< 7 bit target address */
+  std::size_t pointer{0};                               /**< target register pointer */
+  bool selectRegister{false};                           /**< next written byte selects the register */
+  std::uint32_t masterState{STAT_MSTSTATE_IDLE};        /**< current master state */
+
+  static_assert(memorySize > 0, "target needs at least one register!");
+};
+}  // namespace libMcuSim::i2c
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series IAP boot ROM host simulation model
+ *
+ * Replaces libMcuLL::iap::romEntry on a host, include after the device header. Models the flash commands of the boot ROM with
+ * their parameter checks and the prepare before every erase or copy, logs the executed commands and can fail a command on
+ * request. The LL code passes RAM addresses as 32 bit values, the model finds the host memory they belong to in the RAM
+ * regions registered with mapRam. Register the objects holding the buffers passed to copyToFlash and compare, for pageWriter
+ * the writer itself. An address that is not in exactly one region fails with the not mapped status of the command.
+ */
+#ifndef LPC8XX_IAP_SIM_HPP
+#define LPC8XX_IAP_SIM_HPP
+
+#include <algorithm>
+#include <vector>
+
+namespace libMcuSim::iap {
+/**
+ * @brief IAP boot ROM model with a flash array
+ *
+ * Supports prepare, copy RAM to flash, sector and page erase, blank check and compare, other commands return
+ * INVALID_COMMAND. Programming clears bits like NOR flash does.
+ *
+ * @tparam t_size flash size in bytes, a multiple of the sector size
+ */
+template <std::uint32_t t_size>
+struct romEntry {
+  using commands = libMcuLL::iap::commands; /**< IAP command codes */
+  using status = libMcuLL::iap::status;     /**< IAP status codes */
+  static constexpr std::uint32_t sectors{t_size / libMcuLL::iap::sectorSize}; /**< amount of sectors */
+  static constexpr std::uint32_t pages{t_size / libMcuLL::iap::pageSize};     /**< amount of pages */
+  /**
+   * @brief execute an IAP command
+   * @param command command code followed by its parameters
+   * @param result status code followed by the returned values
+   */
+  static void call(std::uint32_t *command, std::uint32_t *result) {
+    commands code = static_cast<commands>(command[0]);
+    log.push_back(code);
+    if (!failures.empty() && failures.front().command == code) {
+      result[0] = static_cast<std::uint32_t>(failures.front().code);
+      failures.erase(failures.begin());
+      return;
+    }
+    result[0] = static_cast<std::uint32_t>(execute(code, command, result));
+  }
+  /**
+   * @brief read words from flash, addresses outside the array read as erased
+   * @param address flash address, word aligned
+   * @param destination words to fill
+   */
+  static void read(std::uint32_t address, std::span<std::uint32_t> destination) {
+    for (std::size_t index = 0; index < destination.size(); index++) {
+      std::uint32_t word = address / 4u + static_cast<std::uint32_t>(index);
+      destination[index] = word < memory.size() ? memory[word] : erasedWord;
+    }
+  }
+  /**
+   * @brief register host memory the LL code passes to the ROM, the lower 32 bits of its address must not overlap another region
+   * @param object first byte of the memory
+   * @param size size in bytes
+   */
+  static void mapRam(const void *object, std::size_t size) {
+    regions.push_back(ramRegion{reinterpret_cast<std::uintptr_t>(object), size});
+  }
+  /**
+   * @brief remove a registered region
+   * @param object first byte of the memory, as passed to mapRam
+   */
+  static void unmapRam(const void *object) {
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(object);
+    std::erase_if(regions, [start](const ramRegion &region) { return region.start == start; });
+  }
+  /**
+   * @brief let a later execution of a command fail without effect, failures are used in the order they were added
+   * @param command command to fail
+   * @param code status code to return
+   */
+  static void fail(commands command, status code) {
+    failures.push_back(failure{command, code});
+  }
+  /**
+   * @brief executed commands since the last reset or clearLog, including failed ones
+   * @return command codes, oldest first
+   */
+  static const std::vector<commands> &getLog() {
+    return log;
+  }
+  /**
+   * @brief clear the command log
+   */
+  static void clearLog() {
+    log.clear();
+  }
+  /**
+   * @brief erase the whole array, clear the log, pending failures and prepared sectors, registered RAM regions are kept
+   */
+  static void reset() {
+    memory.fill(erasedWord);
+    log.clear();
+    failures.clear();
+    prepared = false;
+  }
+
+ private:
+  /**
+   * @brief requested failure of a command
+   */
+  struct failure {
+    commands command; /**< command to fail */
+    status code;      /**< status code to return */
+  };
+  /**
+   * @brief registered host memory
+   */
+  struct ramRegion {
+    std::uintptr_t start; /**< host address of the first byte */
+    std::size_t size;     /**< size in bytes */
+  };
+  /**
+   * @brief execute a command on the flash array
+   * @param code command code
+   * @param command command code followed by its parameters
+   * @param result status code followed by the returned values
+   * @return IAP status
+   */
+  static status execute(commands code, std::uint32_t *command, std::uint32_t *result) {
+    switch (code) {
+      case commands::PREPARE:
+        if ((command[1] > command[2]) || (command[2] >= sectors))
+          return status::INVALID_SECTOR;
+        prepared = true;
+        firstPrepared = command[1];
+        lastPrepared = command[2];
+        return status::CMD_SUCCESS;
+      case commands::ERASE_SECTORS:
+        if ((command[1] > command[2]) || (command[2] >= sectors))
+          return status::INVALID_SECTOR;
+        return erase(command[1] * libMcuLL::iap::sectorSize, (command[2] + 1u) * libMcuLL::iap::sectorSize);
+      case commands::ERASE_PAGES:
+        if ((command[1] > command[2]) || (command[2] >= pages))
+          return status::INVALID_SECTOR;
+        return erase(command[1] * libMcuLL::iap::pageSize, (command[2] + 1u) * libMcuLL::iap::pageSize);
+      case commands::COPY_RAM_TO_FLASH:
+        return copy(command[1], command[2], command[3]);
+      case commands::BLANK_CHECK:
+        return blankCheck(command[1], command[2], result);
+      case commands::COMPARE:
+        return compare(command[1], command[2], command[3], result);
+      default:
+        return status::INVALID_COMMAND;
+    }
+  }
+  /**
+   * @brief check that the sectors of an address range are prepared and lock them again
+   * @param first first byte address
+   * @param end address after the last byte
+   * @return true when prepared
+   */
+  static bool usePrepared(std::uint32_t first, std::uint32_t end) {
+    bool result = prepared && (first / libMcuLL::iap::sectorSize >= firstPrepared) &&
+                  ((end - 1u) / libMcuLL::iap::sectorSize <= lastPrepared);
+    prepared = false;
+    return result;
+  }
+  /**
+   * @brief erase an address range
+   * @param first first byte address, page aligned
+   * @param end address after the last byte, page aligned
+   * @return IAP status
+   */
+  static status erase(std::uint32_t first, std::uint32_t end) {
+    if (!usePrepared(first, end))
+      return status::SECTOR_NOT_PREPARED;
+    std::fill(memory.begin() + first / 4u, memory.begin() + end / 4u, erasedWord);
+    return status::CMD_SUCCESS;
+  }
+  /**
+   * @brief program flash with words from RAM
+   * @param destination flash address
+   * @param source RAM address
+   * @param count bytes to copy
+   * @return IAP status
+   */
+  static status copy(std::uint32_t destination, std::uint32_t source, std::uint32_t count) {
+    if (destination % libMcuLL::iap::pageSize != 0)
+      return status::DST_ADDR_ERROR;
+    if (source % 4u != 0)
+      return status::SRC_ADDR_ERROR;
+    if ((count != 64u) && (count != 128u) && (count != 256u) && (count != 512u) && (count != 1024u))
+      return status::COUNT_ERROR;
+    if (destination + count > t_size)
+      return status::DST_ADDR_NOT_MAPPED;
+    const std::uint32_t *words = toPointer(source, count);
+    if (words == nullptr)
+      return status::SRC_ADDR_NOT_MAPPED;
+    if (!usePrepared(destination, destination + count))
+      return status::SECTOR_NOT_PREPARED;
+    for (std::uint32_t index = 0; index < count / 4u; index++)
+      memory[destination / 4u + index] &= words[index];
+    return status::CMD_SUCCESS;
+  }
+  /**
+   * @brief check if sectors are erased
+   * @param first first sector
+   * @param last last sector
+   * @param result offset and contents of the first non blank word
+   * @return IAP status
+   */
+  static status blankCheck(std::uint32_t first, std::uint32_t last, std::uint32_t *result) {
+    if ((first > last) || (last >= sectors))
+      return status::INVALID_SECTOR;
+    std::uint32_t wordsPerSector = libMcuLL::iap::sectorSize / 4u;
+    for (std::uint32_t word = first * wordsPerSector; word < (last + 1u) * wordsPerSector; word++) {
+      if (memory[word] != erasedWord) {
+        result[1] = word * 4u;
+        result[2] = memory[word];
+        return status::SECTOR_NOT_BLANK;
+      }
+    }
+    return status::CMD_SUCCESS;
+  }
+  /**
+   * @brief compare flash with words in RAM
+   * @param destination flash address
+   * @param source RAM address
+   * @param count bytes to compare
+   * @param result offset of the first difference
+   * @return IAP status
+   */
+  static status compare(std::uint32_t destination, std::uint32_t source, std::uint32_t count, std::uint32_t *result) {
+    if ((destination % 4u != 0) || (source % 4u != 0))
+      return status::ADDR_ERROR;
+    if (count % 4u != 0)
+      return status::COUNT_ERROR;
+    const std::uint32_t *words = toPointer(source, count);
+    if ((destination + count > t_size) || (words == nullptr))
+      return status::ADDR_NOT_MAPPED;
+    for (std::uint32_t index = 0; index < count / 4u; index++) {
+      if (memory[destination / 4u + index] != words[index]) {
+        result[1] = index * 4u;
+        return status::COMPARE_ERROR;
+      }
+    }
+    return status::CMD_SUCCESS;
+  }
+  /**
+   * @brief find the host memory of a 32 bit RAM address in the registered regions
+   * @param address 32 bit address passed by the LL code
+   * @param count bytes used from the address
+   * @return host pointer, nullptr when the bytes are not in exactly one region
+   */
+  static const std::uint32_t *toPointer(std::uint32_t address, std::uint32_t count) {
+    const std::uint32_t *found = nullptr;
+    for (const ramRegion &region : regions) {
+      std::uint32_t offset = address - static_cast<std::uint32_t>(region.start);
+      if ((offset >= region.size) || (count > region.size - offset))
+        continue;
+      if (found != nullptr)
+        return nullptr;
+      found = reinterpret_cast<const std::uint32_t *>(region.start + offset);
+    }
+    return found;
+  }
+
+  static constexpr std::uint32_t erasedWord{0xFFFF'FFFFu}; /**< contents of erased flash */
+  /**
+   * @brief flash contents, erased at startup
+   */
+  static inline std::array<std::uint32_t, t_size / 4u> memory = [] {
+    std::array<std::uint32_t, t_size / 4u> erased;
+    erased.fill(erasedWord);
+    return erased;
+  }();
+  static inline std::vector<commands> log;       /**< executed commands */
+  static inline std::vector<failure> failures;  /**< commands to fail */
+  static inline std::vector<ramRegion> regions; /**< host memory the LL code passes to the ROM */
+  static inline bool prepared{false};           /**< sectors are prepared */
+  static inline std::uint32_t firstPrepared{0}; /**< first prepared sector */
+  static inline std::uint32_t lastPrepared{0};  /**< last prepared sector */
+};
+}  // namespace libMcuSim::iap
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series SPI host simulation model
+ */
+#ifndef LPC8XX_SPI_SIM_HPP
+#define LPC8XX_SPI_SIM_HPP
+
+#include <cstddef>
+#include <deque>
+#include "../../host/host_sim.hpp"
+
+namespace libMcuSim::spi {
+/**
+ * @brief SPI master model with MOSI connected to MISO
+ *
+ * Transfers complete instantly, every transmitted frame is recorded and received back unless RXIGNORE is set.
+ *
+ * @tparam registers SPI register structure of the simulated device
+ */
+template <typename registers>
+struct spiLoopback : peripheralModel {
+  /**
+   * @brief map the SPI registers and attach this model
+   * @param address SPI peripheral base address
+   * @return NO_ERROR when attached, ERROR otherwise
+   */
+  libMcu::results attach(libMcu::hwAddressType address) {
+    return libMcuSim::attach(*this, address, sizeof(registers));
+  }
+  /**
+   * @brief frames written by the LL code, oldest first
+   * @return transmitted frames, masked to their length
+   */
+  std::deque<std::uint16_t>& transmitted() {
+    synchronize();
+    return transmitFifo;
+  }
+  /**
+   * @brief amount of transfers ended with end of transfer
+   * @return transfer count
+   */
+  std::uint32_t getTransfers() const {
+    synchronize();
+    return transfers;
+  }
+  void beforeRead(std::uint32_t offset) override {
+    if (offset == offsetof(registers, STAT)) {
+      setRegister(offset, STAT_TXRDY | STAT_MSTIDLE | (receiveFifo.empty() ? 0u : STAT_RXRDY));
+    } else if (offset == offsetof(registers, RXDAT)) {
+      setRegister(offset, receiveFifo.empty() ? 0u : receiveFifo.front());
+    }
+  }
+  void afterRead(std::uint32_t offset) override {
+    if ((offset == offsetof(registers, RXDAT)) && !receiveFifo.empty())
+      receiveFifo.pop_front();
+  }
+  void afterWrite(std::uint32_t offset) override {
+    if (offset == offsetof(registers, TXDATCTL)) {
+      std::uint32_t value = getRegister(offset);
+      control = value & CONTROL_MASK;
+      transfer(value & DATA_MASK);
+    } else if (offset == offsetof(registers, TXCTL)) {
+      control = getRegister(offset) & CONTROL_MASK;
+    } else if (offset == offsetof(registers, TXDAT)) {
+      transfer(getRegister(offset) & DATA_MASK);
+    }
+  }
+
+ private:
+  /**
+   * @brief transfer a single frame with the current control settings
+   * @param data frame to transmit
+   */
+  void transfer(std::uint32_t data) {
+    std::uint32_t length = ((control >> 24) & 0x0Fu) + 1;
+    std::uint16_t frame = static_cast<std::uint16_t>(data & ((1u << length) - 1));
+    transmitFifo.push_back(frame);
+    if ((control & TXDATCTL_RXIGNORE) == 0)
+      receiveFifo.push_back(frame | (control & TXDATCTL_TXSSEL_MASK));
+    if (control & TXDATCTL_EOT)
+      transfers++;
+  }
+
+  static constexpr std::uint32_t STAT_RXRDY{1u << 0};              /**< LPC800 SPI receiver ready */
+  static constexpr std::uint32_t STAT_TXRDY{1u << 1};              /**< LPC800 SPI transmitter ready */
+  static constexpr std::uint32_t STAT_MSTIDLE{1u << 8};            /**< LPC800 SPI master idle */
+  static constexpr std::uint32_t TXDATCTL_TXSSEL_MASK{0xFu << 16}; /**< LPC800 SPI slave selects, copied to RXSSEL */
+  static constexpr std::uint32_t TXDATCTL_EOT{1u << 20};           /**< LPC800 SPI end of transfer */
+  static constexpr std::uint32_t TXDATCTL_RXIGNORE{1u << 22};      /**< LPC800 SPI receive ignore */
+  static constexpr std::uint32_t DATA_MASK{0x0000'FFFFu};          /**< LPC800 SPI data field */
+  static constexpr std::uint32_t CONTROL_MASK{0x0F7F'0000u};       /**< LPC800 SPI control fields */
+
+  std::deque<std::uint32_t> receiveFifo;  /**< frames to be read by the LL code */
+  std::deque<std::uint16_t> transmitFifo; /**< frames written by the LL code */
+  std::uint32_t control{0};               /**< current transfer control settings */
+  std::uint32_t transfers{0};             /**< completed transfers */
+};
+}  // namespace libMcuSim::spi
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC800 series USART host simulation model
+ */
+#ifndef LPC8XX_USART_SIM_HPP
+#define LPC8XX_USART_SIM_HPP
+
+#include <cstddef>
+#include <deque>
+#include "../../host/host_sim.hpp"
+
+namespace libMcuSim::usart {
+/**
+ * @brief USART model with receive and transmit FIFO
+ *
+ * The transmitter is always ready, every written character ends up in the transmit FIFO. Characters put in the receive FIFO
+ * are presented one by one in RXDAT/RXDATSTAT with RXRDY set in STAT.
+ *
+ * @tparam registers USART register structure of the simulated device
+ */
+template <typename registers>
+struct usart : peripheralModel {
+  /**
+   * @brief map the USART registers and attach this model
+   * @param address USART peripheral base address
+   * @return NO_ERROR when attached, ERROR otherwise
+   */
+  libMcu::results attach(libMcu::hwAddressType address) {
+    return libMcuSim::attach(*this, address, sizeof(registers));
+  }
+  /**
+   * @brief put a character in the receive FIFO
+   * @param data character to receive
+   */
+  void receive(std::uint32_t data) {
+    synchronize();
+    receiveFifo.push_back(data);
+    synchronize();
+  }
+  /**
+   * @brief characters written by the LL code, oldest first
+   * @return transmit FIFO
+   */
+  std::deque<std::uint32_t>& transmitted() {
+    synchronize();
+    return transmitFifo;
+  }
+  /**
+   * @brief connect the transmitter to the receiver
+   * @param enable true to receive all transmitted characters
+   */
+  void loopback(bool enable) {
+    synchronize();
+    loopbackEnabled = enable;
+    synchronize();
+  }
+  void beforeRead(std::uint32_t offset) override {
+    if (offset == offsetof(registers, STAT)) {
+      std::uint32_t status = STAT_TXRDY | STAT_TXIDLE;
+      status = status | (receiveFifo.empty() ? STAT_RXIDLE : STAT_RXRDY);
+      setRegister(offset, status);
+    } else if ((offset == offsetof(registers, RXDAT)) || (offset == offsetof(registers, RXDATSTAT))) {
+      setRegister(offset, receiveFifo.empty() ? 0u : receiveFifo.front() & DATA_MASK);
+    }
+  }
+  void afterRead(std::uint32_t offset) override {
+    if ((offset == offsetof(registers, RXDAT)) || (offset == offsetof(registers, RXDATSTAT))) {
+      if (!receiveFifo.empty())
+        receiveFifo.pop_front();
+    }
+  }
+  void afterWrite(std::uint32_t offset) override {
+    if (offset == offsetof(registers, TXDAT)) {
+      std::uint32_t data = getRegister(offset) & DATA_MASK;
+      transmitFifo.push_back(data);
+      if (loopbackEnabled)
+        receiveFifo.push_back(data);
+    }
+  }
+
+ private:
+  static constexpr std::uint32_t STAT_RXRDY{1u << 0};  /**< LPC800 USART receiver ready */
+  static constexpr std::uint32_t STAT_RXIDLE{1u << 1}; /**< LPC800 USART receiver idle */
+  static constexpr std::uint32_t STAT_TXRDY{1u << 2};  /**< LPC800 USART transmitter ready */
+  static constexpr std::uint32_t STAT_TXIDLE{1u << 3}; /**< LPC800 USART transmitter idle */
+  static constexpr std::uint32_t DATA_MASK{0x1FFu};    /**< LPC800 USART data, up to 9 bits */
+
+  std::deque<std::uint32_t> receiveFifo;  /**< characters to be read by the LL code */
+  std::deque<std::uint32_t> transmitFifo; /**< characters written by the LL code */
+  bool loopbackEnabled{false};            /**< transmitted characters are received */
+};
+}  // namespace libMcuSim::usart
+
+#endif
@@ -100,6 +100,7 @@ constexpr inline libMcu::pinintBaseAddress pinintAddress{0xA000'4000u}; /**< Pin
 #include "LPC8XX_HW/LPC81X_i2c_hw.hpp"
 #include "LPC8XX_HW/LPC81X_mrt_hw.hpp"
 #include "LPC8XX_HW/LPC81X_pin_int_hw.hpp"
+#include "LPC8XX_HW/LPC8XX_pattern_match.hpp"
 #include "LPC8XX_HW/LPC81X_pmu_hw.hpp"
 #include "LPC8XX_HW/LPC81X_sct_hw.hpp"
 #include "LPC8XX_HW/LPC81X_syscon_hw.hpp"
@@ -121,6 +122,8 @@ constexpr inline libMcu::pinintBaseAddress pinintAddress{0xA000'4000u}; /**< Pin
 #include "LPC8XX_LL/LPC81X_acmp_ll.hpp"
 #include "LPC8XX_LL/LPC81X_crc_ll.hpp"
 #include "LPC8XX_LL/LPC81X_fmc_ll.hpp"
+#include "LPC8XX_LL/LPC8XX_iap_ll.hpp"
+#include "LPC8XX_LL/LPC8XX_kvstore_ll.hpp"
 #include "LPC8XX_LL/LPC81X_i2c_ll.hpp"
 #include "LPC8XX_LL/LPC81X_mrt_ll.hpp"
 #include "LPC8XX_LL/LPC81X_pin_int_ll.hpp"
@@ -131,5 +134,6 @@ constexpr inline libMcu::pinintBaseAddress pinintAddress{0xA000'4000u}; /**< Pin
 #include "LPC8XX_LL/LPC81X_usart_ll_async.hpp"
 #include "LPC8XX_LL/LPC81X_wkt_ll.hpp"
 #include "LPC8XX_LL/LPC81X_wwdt_ll.hpp"
+#include "LPC8XX_LL/LPC81X_power_ll.hpp"
 
 #endif
\ No newline at end of file
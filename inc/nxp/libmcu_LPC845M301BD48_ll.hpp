@@ -154,6 +154,24 @@ enum class dmaRequestSources : std::uint8_t {
   dac1 = 23u,       /**< DAC1 DMA REQUEST  */
   capt = 24u,       /**< CAPT DMA  */
 };
+/**
+ * @brief DMA hardware trigger sources, selected per DMA channel through the input multiplexer
+ */
+enum class dmaTriggerSources : std::uint8_t {
+  adc0SeqA = 0u,       /**< ADC0 sequence A interrupt */
+  adc0SeqB = 1u,       /**< ADC0 sequence B interrupt */
+  sct0Dma0 = 2u,       /**< SCT0 DMA request 0 */
+  sct0Dma1 = 3u,       /**< SCT0 DMA request 1 */
+  acmpOut = 4u,        /**< analog comparator output */
+  pinint4 = 5u,        /**< pin interrupt 4 */
+  pinint5 = 6u,        /**< pin interrupt 5 */
+  pinint6 = 7u,        /**< pin interrupt 6 */
+  pinint7 = 8u,        /**< pin interrupt 7 */
+  ctimer0Match0 = 9u,  /**< CTIMER0 match 0 DMA request */
+  ctimer0Match1 = 10u, /**< CTIMER0 match 1 DMA request */
+  dmaInmux0 = 11u,     /**< DMA output trigger selected by DMA_INMUX_INMUX0 */
+  dmaInmux1 = 12u,     /**< DMA output trigger selected by DMA_INMUX_INMUX1 */
+};
 }  // namespace libMcuHw::dma
 
 // includes that define the registers namespace go here.
@@ -181,6 +199,7 @@ enum class dmaRequestSources : std::uint8_t {
 #include "LPC8XX_HW/LPC84X_mtb_hw.hpp"
 #include "LPC8XX_HW/LPC84X_gpio_hw.hpp"
 #include "LPC8XX_HW/LPC84X_pinint_hw.hpp"
+#include "LPC8XX_HW/LPC8XX_pattern_match.hpp"
 
 // device peripheral specific headers go here
 // these need to go after registers namespace definitions as they are used here
@@ -195,6 +214,17 @@ enum class dmaRequestSources : std::uint8_t {
 #include "LPC8XX_LL/LPC84X_usart_ll.hpp"
 #include "LPC8XX_LL/LPC84X_gpio_ll.hpp"
 #include "LPC8XX_LL/LPC84X_adc_ll.hpp"
+#include "LPC8XX_LL/LPC84X_capt_ll.hpp"
+#include "LPC8XX_LL/LPC84X_pinint_ll.hpp"
+#include "LPC8XX_LL/LPC84X_inmux_ll.hpp"
+#include "LPC8XX_LL/LPC84X_ctimer_ll.hpp"
+#include "LPC8XX_LL/LPC84X_dma_ll.hpp"
+#include "LPC8XX_LL/LPC84X_dac_ll.hpp"
+#include "LPC8XX_LL/LPC8XX_iap_ll.hpp"
+#include "LPC8XX_LL/LPC8XX_kvstore_ll.hpp"
+#include "LPC8XX_LL/LPC84X_faim_ll.hpp"
+#include "LPC8XX_LL/LPC84X_crc_ll.hpp"
+#include "LPC8XX_LL/LPC84X_mtb_ll.hpp"
 
 #include "LPC8XX_CLOCK/LPC84X_clock.hpp"
 
@@ -0,0 +1,246 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file RP2040_clock.hpp
+ * \brief RP2040 compile time clock calculations
+ */
+#ifndef RP2040_CLOCK_HPP
+#define RP2040_CLOCK_HPP
+
+namespace libMcuHw::clock {
+
+constexpr inline std::uint32_t pllMinVcoFreq{750'000'000};   /**< minimum PLL VCO frequency */
+constexpr inline std::uint32_t pllMaxVcoFreq{1'600'000'000}; /**< maximum PLL VCO frequency */
+constexpr inline std::uint32_t pllMinRefFreq{5'000'000};     /**< minimum PLL reference frequency after REFDIV */
+constexpr inline std::uint32_t pllMinRefDiv{1};              /**< minimum REFDIV value */
+constexpr inline std::uint32_t pllMaxRefDiv{63};             /**< maximum REFDIV value */
+constexpr inline std::uint32_t pllMinFbDiv{16};              /**< minimum FBDIV value */
+constexpr inline std::uint32_t pllMaxFbDiv{320};             /**< maximum FBDIV value */
+constexpr inline std::uint32_t pllMinPostDiv{1};             /**< minimum POSTDIV1/POSTDIV2 value */
+constexpr inline std::uint32_t pllMaxPostDiv{7};             /**< maximum POSTDIV1/POSTDIV2 value */
+
+/**
+ * @brief PLL optimization goal when multiple settings reach the same frequency
+ */
+enum class pllOptimizations : std::uint8_t {
+  POWER,  /**< lowest VCO frequency, lowest power consumption */
+  JITTER, /**< highest VCO frequency, lowest output jitter */
+};
+
+/**
+ * @brief PLL register settings
+ */
+struct pllSettings {
+  std::uint32_t refDiv;     /**< reference divider */
+  std::uint32_t fbDiv;      /**< feedback divider */
+  std::uint32_t postDiv1;   /**< first post divider, always larger or equal to postDiv2 */
+  std::uint32_t postDiv2;   /**< second post divider */
+  std::uint32_t vcoFreq;    /**< VCO frequency */
+  std::uint32_t outputFreq; /**< output frequency, rounded down */
+  std::uint32_t error;      /**< absolute difference between requested and output frequency, rounded up */
+};
+
+/**
+ * @brief Search all legal PLL settings for a target frequency
+ *
+ * The closest frequency wins, ties are broken by VCO frequency according to the optimization goal and then by the largest
+ * reference frequency (smallest refDiv) for lower jitter.
+ *
+ * @param inputFreq PLL input (crystal) frequency
+ * @param targetFreq wanted PLL output frequency
+ * @param optimization tie breaker between equally close settings
+ * @param maxError largest acceptable error in Hz
+ * @return PLL settings, refDiv is zero when no setting is within maxError
+ */
+consteval pllSettings findPllSettings(std::uint32_t inputFreq, std::uint32_t targetFreq, pllOptimizations optimization,
+                                      std::uint32_t maxError) {
+  pllSettings best{0, 0, 0, 0, 0, 0, 0};
+  // errors are compared as error * postDivider fractions to stay exact
+  std::uint64_t bestErrorScaled = 0;
+  std::uint64_t bestPostDiv = 1;
+  for (std::uint32_t refDiv = pllMinRefDiv; refDiv <= pllMaxRefDiv; refDiv++) {
+    std::uint64_t refFreq = inputFreq / refDiv;
+    if (refFreq < pllMinRefFreq)
+      break;
+    if ((inputFreq % refDiv) != 0)
+      continue;
+    for (std::uint32_t fbDiv = pllMinFbDiv; fbDiv <= pllMaxFbDiv; fbDiv++) {
+      std::uint64_t vcoFreq = refFreq * fbDiv;
+      if (vcoFreq < pllMinVcoFreq)
+        continue;
+      if (vcoFreq > pllMaxVcoFreq)
+        break;
+      for (std::uint32_t postDiv1 = pllMinPostDiv; postDiv1 <= pllMaxPostDiv; postDiv1++) {
+        for (std::uint32_t postDiv2 = pllMinPostDiv; postDiv2 <= postDiv1; postDiv2++) {
+          std::uint64_t postDiv = postDiv1 * postDiv2;
+          std::uint64_t wanted = static_cast<std::uint64_t>(targetFreq) * postDiv;
+          std::uint64_t errorScaled = vcoFreq > wanted ? vcoFreq - wanted : wanted - vcoFreq;
+          if (errorScaled > static_cast<std::uint64_t>(maxError) * postDiv)
+            continue;
+          bool better = best.refDiv == 0;
+          if (!better) {
+            std::uint64_t lhs = errorScaled * bestPostDiv;
+            std::uint64_t rhs = bestErrorScaled * postDiv;
+            if (lhs < rhs)
+              better = true;
+            else if (lhs == rhs) {
+              if (optimization == pllOptimizations::POWER)
+                better = vcoFreq < best.vcoFreq;
+              else
+                better = vcoFreq > best.vcoFreq;
+            }
+          }
+          if (better) {
+            bestErrorScaled = errorScaled;
+            bestPostDiv = postDiv;
+            best = {refDiv,
+                    fbDiv,
+                    postDiv1,
+                    postDiv2,
+                    static_cast<std::uint32_t>(vcoFreq),
+                    static_cast<std::uint32_t>(vcoFreq / postDiv),
+                    static_cast<std::uint32_t>((errorScaled + postDiv - 1) / postDiv)};
+          }
+        }
+      }
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief PLL configuration generation
+ *
+ * Fails to compile when no legal setting is within the allowed error.
+ *
+ * @tparam t_inputFreq PLL input (crystal) frequency
+ * @tparam t_targetFreq wanted PLL output frequency
+ * @tparam t_optimization tie breaker between equally close settings
+ * @tparam t_maxError largest acceptable error in Hz, default is exact
+ */
+template <std::uint32_t t_inputFreq, std::uint32_t t_targetFreq, pllOptimizations t_optimization = pllOptimizations::POWER,
+          std::uint32_t t_maxError = 0>
+struct pllConfig {
+  static constexpr pllSettings settings{
+    findPllSettings(t_inputFreq, t_targetFreq, t_optimization, t_maxError)}; /**< search result */
+  static_assert(settings.refDiv != 0, "Unable to find a PLL configuration solution");
+  static constexpr std::uint32_t inputFreq{t_inputFreq};          /**< PLL input frequency */
+  static constexpr std::uint32_t targetFreq{t_targetFreq};        /**< requested output frequency */
+  static constexpr std::uint32_t refDiv{settings.refDiv};         /**< reference divider */
+  static constexpr std::uint32_t fbDiv{settings.fbDiv};           /**< feedback divider */
+  static constexpr std::uint32_t postDiv1{settings.postDiv1};     /**< first post divider */
+  static constexpr std::uint32_t postDiv2{settings.postDiv2};     /**< second post divider */
+  static constexpr std::uint32_t vcoFreq{settings.vcoFreq};       /**< VCO frequency */
+  static constexpr std::uint32_t outputFreq{settings.outputFreq}; /**< achieved output frequency */
+  static constexpr bool exact{settings.error == 0};               /**< output frequency matches exactly */
+};
+
+constexpr inline std::uint32_t uartMaxIbrd{65'535}; /**< maximum UART integer baud rate divisor */
+constexpr inline std::uint32_t uartMaxFbrd{63};     /**< maximum UART fractional baud rate divisor */
+
+/**
+ * @brief UART baud rate divisor settings
+ */
+struct uartBaudSettings {
+  std::uint32_t ibrd;     /**< integer baud rate divisor, zero when the baud rate is out of range */
+  std::uint32_t fbrd;     /**< fractional baud rate divisor in 1/64 steps */
+  std::uint32_t baudRate; /**< achieved baud rate, rounded down */
+  std::uint32_t error;    /**< absolute difference between requested and achieved baud rate, rounded up */
+};
+
+/**
+ * @brief Calculate UART divisors for a baud rate
+ *
+ * The baud rate is periFreq / (16 * (ibrd + fbrd / 64)), the divisor is rounded to the nearest 1/64 step.
+ *
+ * @param periFreq peripheral clock frequency
+ * @param baudRate wanted baud rate
+ * @return divisor settings, ibrd is zero when the baud rate can not be reached
+ */
+consteval uartBaudSettings findUartBaudSettings(std::uint32_t periFreq, std::uint32_t baudRate) {
+  if (baudRate == 0)
+    return {0, 0, 0, 0};
+  // divisor in 1/64 steps is 64 * periFreq / (16 * baudRate)
+  std::uint64_t scaledFreq = static_cast<std::uint64_t>(periFreq) * 4u;
+  std::uint64_t divisor = (scaledFreq + baudRate / 2) / baudRate;
+  std::uint64_t ibrd = divisor >> 6;
+  std::uint64_t fbrd = divisor & uartMaxFbrd;
+  if (ibrd == 0 || ibrd > uartMaxIbrd || (ibrd == uartMaxIbrd && fbrd != 0))
+    return {0, 0, 0, 0};
+  std::uint64_t wanted = static_cast<std::uint64_t>(baudRate) * divisor;
+  std::uint64_t errorScaled = scaledFreq > wanted ? scaledFreq - wanted : wanted - scaledFreq;
+  return {static_cast<std::uint32_t>(ibrd), static_cast<std::uint32_t>(fbrd), static_cast<std::uint32_t>(scaledFreq / divisor),
+          static_cast<std::uint32_t>((errorScaled + divisor - 1) / divisor)};
+}
+
+constexpr inline std::uint32_t xoscMinFreq{1'000'000};      /**< minimum crystal frequency in the 1-15MHz range */
+constexpr inline std::uint32_t xoscMaxFreq{15'000'000};     /**< maximum crystal frequency in the 1-15MHz range */
+constexpr inline std::uint32_t xoscMaxStartupDelay{0x3FFF}; /**< maximum XOSC STARTUP DELAY value */
+constexpr inline std::uint32_t sysMaxFreq{133'000'000};     /**< maximum system and peripheral clock frequency */
+constexpr inline std::uint32_t usbClockFreq{48'000'000};    /**< USB and ADC clock frequency */
+constexpr inline std::uint32_t rtcClockFreq{46'875};        /**< RTC clock frequency */
+constexpr inline std::uint32_t rtcMaxDivider{0xFF'FFFF};    /**< maximum RTC integer divider */
+
+/**
+ * @brief Clock tree configuration generation
+ *
+ * All clocks are derived from the crystal oscillator: clk_ref runs from XOSC, clk_sys and clk_peri from the system PLL (or
+ * clk_ref when the system frequency equals the crystal frequency), clk_usb and clk_adc from the USB PLL and clk_rtc from
+ * XOSC through the fractional divider. Fails to compile when a clock is out of its limits or can not be reached exactly.
+ * libMcuLL::clocks::clockTree generates the init sequence.
+ *
+ * @tparam t_xoscFreq crystal frequency
+ * @tparam t_sysFreq wanted system and peripheral clock frequency
+ * @tparam t_usbPll true to start the USB PLL and clock USB and ADC, false leaves them unclocked
+ * @tparam t_optimization system PLL tie breaker between equally close settings
+ */
+template <std::uint32_t t_xoscFreq, std::uint32_t t_sysFreq, bool t_usbPll = true,
+          pllOptimizations t_optimization = pllOptimizations::POWER>
+struct clockTreeConfig {
+  static_assert(t_xoscFreq >= xoscMinFreq && t_xoscFreq <= xoscMaxFreq, "Crystal frequency out of range!");
+  static_assert(t_sysFreq <= sysMaxFreq, "System frequency too high!");
+
+  static constexpr bool sysPllUsed{t_sysFreq != t_xoscFreq}; /**< system clock is taken from the system PLL */
+  static constexpr bool usbPllUsed{t_usbPll};                /**< USB PLL is started */
+  static constexpr pllSettings pllSys{sysPllUsed ? findPllSettings(t_xoscFreq, t_sysFreq, t_optimization, 0)
+                                                 : pllSettings{0, 0, 0, 0, 0, 0, 0}}; /**< system PLL settings */
+  static constexpr pllSettings pllUsb{usbPllUsed ? findPllSettings(t_xoscFreq, usbClockFreq, pllOptimizations::POWER, 0)
+                                                 : pllSettings{0, 0, 0, 0, 0, 0, 0}}; /**< USB PLL settings */
+  static_assert(!sysPllUsed || pllSys.refDiv != 0, "Unable to find a system PLL configuration solution");
+  static_assert(!usbPllUsed || pllUsb.refDiv != 0, "Unable to find a USB PLL configuration solution");
+
+  static constexpr std::uint32_t xoscStartupDelay{((t_xoscFreq / 1000) + 128) / 256}; /**< XOSC startup delay, about 1ms */
+  static_assert(xoscStartupDelay <= xoscMaxStartupDelay, "Crystal startup delay out of range!");
+  static constexpr std::uint32_t rtcDivider{
+    static_cast<std::uint32_t>(static_cast<std::uint64_t>(t_xoscFreq) * 256u / rtcClockFreq)}; /**< RTC divider, 8 bit fraction */
+  static_assert((rtcDivider >> 8) >= 1 && (rtcDivider >> 8) <= rtcMaxDivider, "RTC divider out of range!");
+
+  static constexpr std::uint32_t xoscFreq{t_xoscFreq};                  /**< crystal frequency */
+  static constexpr std::uint32_t refFreq{t_xoscFreq};                   /**< clk_ref frequency */
+  static constexpr std::uint32_t sysFreq{t_sysFreq};                    /**< clk_sys frequency */
+  static constexpr std::uint32_t periFreq{t_sysFreq};                   /**< clk_peri frequency */
+  static constexpr std::uint32_t usbFreq{t_usbPll ? usbClockFreq : 0u}; /**< clk_usb frequency, zero when disabled */
+  static constexpr std::uint32_t adcFreq{t_usbPll ? usbClockFreq : 0u}; /**< clk_adc frequency, zero when disabled */
+  static constexpr std::uint32_t rtcFreq{
+    static_cast<std::uint32_t>(static_cast<std::uint64_t>(t_xoscFreq) * 256u / rtcDivider)}; /**< clk_rtc frequency */
+
+  /**
+   * @brief delay needed after disabling a clock generator, 3 cycles of its output
+   * @param freq clock generator output frequency
+   * @return libMcuLL::delay loops when running from clk_sys, never zero
+   */
+  static consteval std::uint32_t disableDelay(std::uint32_t freq) {
+    return freq == 0 ? 1u : sysFreq / freq + 1;
+  }
+  static constexpr std::uint32_t periDelay{disableDelay(periFreq)}; /**< clk_peri disable delay */
+  static constexpr std::uint32_t usbDelay{disableDelay(usbFreq)};   /**< clk_usb disable delay */
+  static constexpr std::uint32_t adcDelay{disableDelay(adcFreq)};   /**< clk_adc disable delay */
+  static constexpr std::uint32_t rtcDelay{disableDelay(rtcFreq)};   /**< clk_rtc disable delay */
+};
+}  // namespace libMcuHw::clock
+
+#endif
@@ -123,6 +123,26 @@ struct gpio : libMcuHal::halGpioBase {
       static_assert("Unknown port!");
     }
   }
+  /**
+   * @brief Set multiple gpio pins of one port in a single write
+   *
+   * Only the pins in mask change and they all change at the same moment. The XOR alias is used so pins outside of mask are
+   * never written, even when they are changed from an interrupt between the read and the write.
+   * @tparam PIN pin instance
+   * @param pin reference to a pin instance on the port to write
+   * @param mask pins to change
+   * @param setting new pin states, bits outside of mask are ignored
+   */
+  template <typename PIN>
+  constexpr void portSetMasked([[maybe_unused]] PIN& pin, std::uint32_t mask, std::uint32_t setting) {
+    if constexpr (PIN::port == libMcuHw::IOports::PORT0) {
+      sioPeripheral()->GPIO_OUT_XOR = (sioPeripheral()->GPIO_OUT ^ setting) & mask;
+    } else if constexpr (PIN::port == libMcuHw::IOports::QSPI) {
+      sioPeripheral()->GPIO_HI_OUT_XOR = (sioPeripheral()->GPIO_HI_OUT ^ setting) & mask;
+    } else {
+      static_assert("Unknown port!");
+    }
+  }
   /**
    * @brief Get the gpio pin state
    * @tparam PIN pin instance
@@ -13,11 +13,34 @@
 namespace libMcuHal::spi {
 
 template <libMcu::spiBaseAddress const& spiBaseAddress_>
-struct spi {
+struct spi : libMcuHal::halSpiBase {
   /**
    * @brief Initialize the spi HAL
    */
   void initialize() {}
+  /**
+   * @brief Write a buffer of bytes to the SPI peripheral and wait until the transfer is done
+   *
+   * The peripheral must be setup as master beforehand. The transmit FIFO is kept filled so the chip select stays asserted for
+   * the whole buffer when the waveform uses CPHA 1, received data is discarded.
+   * @param transmitBuffer data to transmit
+   */
+  void write(std::span<std::uint8_t> transmitBuffer) {
+    spiPeripheral()->SSPCR0 = (spiPeripheral()->SSPCR0 & ~libMcuHw::spi::SSPCR0::DSS_MASK) | libMcuHw::spi::SSPCR0::DSS_8BIT;
+    spiPeripheralSet()->SSPCR1 = libMcuHw::spi::SSPCR1::SSE;
+    for (std::uint8_t data : transmitBuffer) {
+      while ((spiPeripheral()->SSPSR & libMcuHw::spi::SSPSR::TNF_MASK) == 0)
+        ;
+      spiPeripheral()->SSPDR = data;
+      // drain the receive FIFO so it can not overrun
+      while (spiPeripheral()->SSPSR & libMcuHw::spi::SSPSR::RNE_MASK)
+        (void)spiPeripheral()->SSPDR;
+    }
+    while (spiPeripheral()->SSPSR & libMcuHw::spi::SSPSR::BSY_MASK)
+      ;
+    while (spiPeripheral()->SSPSR & libMcuHw::spi::SSPSR::RNE_MASK)
+      (void)spiPeripheral()->SSPDR;
+  }
 
  private:
   /**
@@ -25,36 +48,36 @@ struct spi {
    *
    * @return return pointer to peripheral
    */
-  static libMcuHw::gpioBank0::gpioBank0* gpioBank0Peripheral() {
-    return reinterpret_cast<libMcuHw::gpioBank0::gpioBank0*>(spiBaseAddress + libMcuHw::peripheralOffsetNormal);
+  static libMcuHw::spi::spi* spiPeripheral() {
+    return reinterpret_cast<libMcuHw::spi::spi*>(spiBaseAddress + libMcuHw::peripheralOffsetNormal);
   }
   /**
-   * @brief get registers from peripheral
+   * @brief set registers from peripheral
    *
    * @return return pointer to peripheral
    */
-  static libMcuHw::gpioBank0::gpioBank0* gpioBank0PeripheralSet() {
-    return reinterpret_cast<libMcuHw::gpioBank0::gpioBank0*>(spiBaseAddress + libMcuHw::peripheralOffsetSet);
+  static libMcuHw::spi::spi* spiPeripheralSet() {
+    return reinterpret_cast<libMcuHw::spi::spi*>(spiBaseAddress + libMcuHw::peripheralOffsetSet);
   }
   /**
-   * @brief get registers from peripheral
+   * @brief clear registers from peripheral
    *
    * @return return pointer to peripheral
    */
-  static libMcuHw::gpioBank0::gpioBank0* gpioBank0PeripheralClear() {
-    return reinterpret_cast<libMcuHw::gpioBank0::gpioBank0*>(spiBaseAddress + libMcuHw::peripheralOffsetClear);
+  static libMcuHw::spi::spi* spiPeripheralClear() {
+    return reinterpret_cast<libMcuHw::spi::spi*>(spiBaseAddress + libMcuHw::peripheralOffsetClear);
   }
   /**
-   * @brief get registers from peripheral
+   * @brief toggle registers from peripheral
    *
    * @return return pointer to peripheral
    */
-  static libMcuHw::gpioBank0::gpioBank0* gpioBank0PeripheralToggle() {
-    return reinterpret_cast<libMcuHw::gpioBank0::gpioBank0*>(spiBaseAddress + libMcuHw::peripheralOffsetXor);
+  static libMcuHw::spi::spi* spiPeripheralToggle() {
+    return reinterpret_cast<libMcuHw::spi::spi*>(spiBaseAddress + libMcuHw::peripheralOffsetXor);
   }
 
   static constexpr libMcu::hwAddressType spiBaseAddress = spiBaseAddress_; /**< spi peripheral address */
 };
 }  // namespace libMcuHal::spi
 
-#endif
\ No newline at end of file
+#endif
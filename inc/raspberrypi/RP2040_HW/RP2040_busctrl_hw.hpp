@@ -16,10 +16,50 @@ namespace libMcuHw::busctrl {
  *
  */
 struct busctrl {
-  volatile std::uint32_t DUMMY; /**< Fill in */
+  volatile std::uint32_t BUS_PRIORITY;           /**< Set the priority of each master for bus arbitration */
+  volatile const std::uint32_t BUS_PRIORITY_ACK; /**< Bus priority acknowledge */
+  struct {
+    volatile std::uint32_t PERFCTR; /**< Bus fabric performance counter */
+    volatile std::uint32_t PERFSEL; /**< Bus fabric performance event select */
+  } PERF[4];                        /**< Performance counter array */
 };
-namespace DUMMY {
-constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
-}  // namespace DUMMY
+namespace BUS_PRIORITY {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'1111u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t DMA_W{1u << 12};             /**< DMA write master high priority */
+constexpr inline std::uint32_t DMA_R{1u << 8};              /**< DMA read master high priority */
+constexpr inline std::uint32_t PROC1{1u << 4};              /**< Processor 1 high priority */
+constexpr inline std::uint32_t PROC0{1u << 0};              /**< Processor 0 high priority */
+}  // namespace BUS_PRIORITY
+namespace BUS_PRIORITY_ACK {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t ACK{1u << 0};                /**< Priority change has taken effect */
+}  // namespace BUS_PRIORITY_ACK
+namespace PERFCTR {
+constexpr inline std::uint32_t RESERVED_MASK{0x00FF'FFFFu}; /**< Mask for allowed bits, saturating, write to clear */
+}  // namespace PERFCTR
+namespace PERFSEL {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'001Fu}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t APB_CONTESTED{0x00u};        /**< Contested accesses to the APB bridge */
+constexpr inline std::uint32_t APB{0x01u};                  /**< Accesses to the APB bridge */
+constexpr inline std::uint32_t FASTPERI_CONTESTED{0x02u};   /**< Contested accesses to the fast peripherals */
+constexpr inline std::uint32_t FASTPERI{0x03u};             /**< Accesses to the fast peripherals */
+constexpr inline std::uint32_t SRAM5_CONTESTED{0x04u};      /**< Contested accesses to SRAM5 */
+constexpr inline std::uint32_t SRAM5{0x05u};                /**< Accesses to SRAM5 */
+constexpr inline std::uint32_t SRAM4_CONTESTED{0x06u};      /**< Contested accesses to SRAM4 */
+constexpr inline std::uint32_t SRAM4{0x07u};                /**< Accesses to SRAM4 */
+constexpr inline std::uint32_t SRAM3_CONTESTED{0x08u};      /**< Contested accesses to SRAM3 */
+constexpr inline std::uint32_t SRAM3{0x09u};                /**< Accesses to SRAM3 */
+constexpr inline std::uint32_t SRAM2_CONTESTED{0x0Au};      /**< Contested accesses to SRAM2 */
+constexpr inline std::uint32_t SRAM2{0x0Bu};                /**< Accesses to SRAM2 */
+constexpr inline std::uint32_t SRAM1_CONTESTED{0x0Cu};      /**< Contested accesses to SRAM1 */
+constexpr inline std::uint32_t SRAM1{0x0Du};                /**< Accesses to SRAM1 */
+constexpr inline std::uint32_t SRAM0_CONTESTED{0x0Eu};      /**< Contested accesses to SRAM0 */
+constexpr inline std::uint32_t SRAM0{0x0Fu};                /**< Accesses to SRAM0 */
+constexpr inline std::uint32_t XIP_MAIN_CONTESTED{0x10u};   /**< Contested accesses to XIP */
+constexpr inline std::uint32_t XIP_MAIN{0x11u};             /**< Accesses to XIP */
+constexpr inline std::uint32_t ROM_CONTESTED{0x12u};        /**< Contested accesses to ROM */
+constexpr inline std::uint32_t ROM{0x13u};                  /**< Accesses to ROM */
+constexpr inline std::uint32_t NONE{0x1Fu};                 /**< No event, counter stops */
+}  // namespace PERFSEL
 }  // namespace libMcuHw::busctrl
-#endif
\ No newline at end of file
+#endif
@@ -15,10 +15,84 @@ namespace libMcuHw::timer {
  * @brief Timer register definitions
  */
 struct timer {
-  volatile std::uint32_t DUMMY; /**< Fill in */
+  volatile std::uint32_t TIMEHW;         /**< Write to bits 63:32 of time, always write TIMELW before TIMEHW */
+  volatile std::uint32_t TIMELW;         /**< Write to bits 31:0 of time, writes do not get copied to time until TIMEHW */
+  volatile const std::uint32_t TIMEHR;   /**< Read from bits 63:32 of time, always read TIMELR before TIMEHR */
+  volatile const std::uint32_t TIMELR;   /**< Read from bits 31:0 of time, latches TIMEHR */
+  volatile std::uint32_t ALARM[4];       /**< Arm alarm and configure the time it will fire */
+  volatile std::uint32_t ARMED;          /**< Indicates the armed/disarmed status of each alarm */
+  volatile const std::uint32_t TIMERAWH; /**< Raw read from bits 63:32 of time (no side effects) */
+  volatile const std::uint32_t TIMERAWL; /**< Raw read from bits 31:0 of time (no side effects) */
+  volatile std::uint32_t DBGPAUSE;       /**< Set bits high to enable pause when the corresponding debug ports are active */
+  volatile std::uint32_t PAUSE;          /**< Set high to pause the timer */
+  volatile std::uint32_t INTR;           /**< Raw interrupts */
+  volatile std::uint32_t INTE;           /**< Interrupt enable */
+  volatile std::uint32_t INTF;           /**< Interrupt force */
+  volatile const std::uint32_t INTS;     /**< Interrupt status after masking & forcing */
 };
-namespace DUMMY {
-constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
-}  // namespace DUMMY
+namespace ARMED {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format alarm bit in ARMED register
+ * @param alarm alarm index, 0 to 3
+ * @return alarm bit, write to disarm alarm
+ */
+constexpr inline std::uint32_t ALARM(std::uint32_t alarm) {
+  return 1u << alarm;
+}
+}  // namespace ARMED
+namespace DBGPAUSE {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0006u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t DBG1{1u << 2};               /**< Pause when processor 1 is in debug mode */
+constexpr inline std::uint32_t DBG0{1u << 1};               /**< Pause when processor 0 is in debug mode */
+}  // namespace DBGPAUSE
+namespace PAUSE {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t PAUSE{1u << 0};              /**< Pause the timer */
+}  // namespace PAUSE
+namespace INTR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format alarm bit in interrupt registers
+ * @param alarm alarm index, 0 to 3
+ * @return alarm interrupt bit
+ */
+constexpr inline std::uint32_t ALARM(std::uint32_t alarm) {
+  return 1u << alarm;
+}
+}  // namespace INTR
+namespace INTE {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format alarm bit in interrupt registers
+ * @param alarm alarm index, 0 to 3
+ * @return alarm interrupt bit
+ */
+constexpr inline std::uint32_t ALARM(std::uint32_t alarm) {
+  return 1u << alarm;
+}
+}  // namespace INTE
+namespace INTF {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format alarm bit in interrupt registers
+ * @param alarm alarm index, 0 to 3
+ * @return alarm interrupt bit
+ */
+constexpr inline std::uint32_t ALARM(std::uint32_t alarm) {
+  return 1u << alarm;
+}
+}  // namespace INTF
+namespace INTS {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format alarm bit in interrupt registers
+ * @param alarm alarm index, 0 to 3
+ * @return alarm interrupt bit
+ */
+constexpr inline std::uint32_t ALARM(std::uint32_t alarm) {
+  return 1u << alarm;
+}
+}  // namespace INTS
 }  // namespace libMcuHw::timer
-#endif
\ No newline at end of file
+#endif
@@ -11,14 +11,55 @@
 #define RP2040_XIP_CTRL_HW_HPP
 
 namespace libMcuHw::xip {
+constexpr inline std::uint32_t cacheSramAddress{0x1500'0000u};  /**< cache memory when used as SRAM */
+constexpr inline std::uint32_t cacheSramSize{16'384u};          /**< cache memory size in bytes */
+constexpr inline std::uint32_t noAllocAddress{0x1100'0000u};    /**< flash alias, cache hits are used, misses not allocated */
+constexpr inline std::uint32_t noCacheAddress{0x1200'0000u};    /**< flash alias, cache is bypassed but kept coherent */
+constexpr inline std::uint32_t streamFifoAddress{0x5040'0000u}; /**< STREAM_FIFO alias on the fast AHB-Lite bus for DMA */
+constexpr inline std::uint32_t streamDreq{37u};                 /**< DMA request for the streaming FIFO */
 /**
  * @brief Execute In Place register definitions
  */
 struct xip {
-  volatile std::uint32_t DUMMY; /**< Fill in */
+  volatile std::uint32_t CTRL;              /**< Cache control */
+  volatile std::uint32_t FLUSH;             /**< Cache flush control */
+  volatile const std::uint32_t STAT;        /**< Cache status */
+  volatile std::uint32_t CTR_HIT;           /**< Cache hit counter, write to clear */
+  volatile std::uint32_t CTR_ACC;           /**< Cache access counter, write to clear */
+  volatile std::uint32_t STREAM_ADDR;       /**< FIFO stream address */
+  volatile std::uint32_t STREAM_CTR;        /**< FIFO stream control */
+  volatile const std::uint32_t STREAM_FIFO; /**< FIFO stream data */
 };
-namespace DUMMY {
+namespace CTRL {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'000Bu}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t POWER_DOWN{1u << 3};         /**< Power down cache memories, contents are lost */
+constexpr inline std::uint32_t ERR_BADWRITE{1u << 1};       /**< Bus error on writes to flash without cache */
+constexpr inline std::uint32_t EN{1u << 0};                 /**< Enable the cache, disabled cache is usable as SRAM */
+}  // namespace CTRL
+namespace FLUSH {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t FLUSH{1u << 0};              /**< Invalidate cache and clear pins */
+}  // namespace FLUSH
+namespace STAT {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0007u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t FIFO_FULL{1u << 2};          /**< Streaming FIFO is full */
+constexpr inline std::uint32_t FIFO_EMPTY{1u << 1};         /**< Streaming FIFO is empty */
+constexpr inline std::uint32_t FLUSH_READY{1u << 0};        /**< Flush is complete */
+}  // namespace STAT
+namespace CTR_HIT {
 constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
-}  // namespace DUMMY
+}  // namespace CTR_HIT
+namespace CTR_ACC {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
+}  // namespace CTR_ACC
+namespace STREAM_ADDR {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFCu}; /**< Mask for allowed bits */
+}  // namespace STREAM_ADDR
+namespace STREAM_CTR {
+constexpr inline std::uint32_t RESERVED_MASK{0x003F'FFFFu}; /**< Mask for allowed bits, remaining words to stream */
+}  // namespace STREAM_CTR
+namespace STREAM_FIFO {
+constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
+}  // namespace STREAM_FIFO
 }  // namespace libMcuHw::xip
-#endif
\ No newline at end of file
+#endif
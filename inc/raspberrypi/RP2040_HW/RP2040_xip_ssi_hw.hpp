@@ -15,10 +15,144 @@ namespace libMcuHw::xipSsi {
  * @brief Execute In Place serial interface register definitions
  */
 struct xipSsi {
-  volatile std::uint32_t DUMMY; /**< Fill in */
+  volatile std::uint32_t CTRLR0;               /**< Control register 0 */
+  volatile std::uint32_t CTRLR1;               /**< Master control register 1 */
+  volatile std::uint32_t SSIENR;               /**< SSI enable */
+  volatile std::uint32_t MWCR;                 /**< Microwire control */
+  volatile std::uint32_t SER;                  /**< Slave enable */
+  volatile std::uint32_t BAUDR;                /**< Baud rate */
+  volatile std::uint32_t TXFTLR;               /**< TX FIFO threshold level */
+  volatile std::uint32_t RXFTLR;               /**< RX FIFO threshold level */
+  volatile const std::uint32_t TXFLR;          /**< TX FIFO level */
+  volatile const std::uint32_t RXFLR;          /**< RX FIFO level */
+  volatile const std::uint32_t SR;             /**< Status register */
+  volatile std::uint32_t IMR;                  /**< Interrupt mask */
+  volatile const std::uint32_t ISR;            /**< Interrupt status */
+  volatile const std::uint32_t RISR;           /**< Raw interrupt status */
+  volatile const std::uint32_t TXOICR;         /**< TX FIFO overflow interrupt clear */
+  volatile const std::uint32_t RXOICR;         /**< RX FIFO overflow interrupt clear */
+  volatile const std::uint32_t RXUICR;         /**< RX FIFO underflow interrupt clear */
+  volatile const std::uint32_t MSTICR;         /**< Multi-master interrupt clear */
+  volatile const std::uint32_t ICR;            /**< Interrupt clear */
+  volatile std::uint32_t DMACR;                /**< DMA control */
+  volatile std::uint32_t DMATDLR;              /**< DMA TX data level */
+  volatile std::uint32_t DMARDLR;              /**< DMA RX data level */
+  volatile const std::uint32_t IDR;            /**< Identification register */
+  volatile const std::uint32_t SSI_VERSION_ID; /**< Version ID */
+  volatile std::uint32_t DR0;                  /**< Data register 0 */
+  std::uint8_t RESERVED_0[140];                /**< Reserved, data register 1 to 35 */
+  volatile std::uint32_t RX_SAMPLE_DLY;        /**< RX sample delay */
+  volatile std::uint32_t SPI_CTRLR0;           /**< SPI control */
+  volatile std::uint32_t TXD_DRIVE_EDGE;       /**< TX drive edge */
 };
-namespace DUMMY {
-constexpr inline std::uint32_t RESERVED_MASK{0xFFFF'FFFFu}; /**< Mask for allowed bits */
-}  // namespace DUMMY
+namespace CTRLR0 {
+constexpr inline std::uint32_t RESERVED_MASK{0x017F'FFFFu}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t SSTE{1u << 24};              /**< Slave select toggle enable */
+constexpr inline std::uint32_t SPI_FRF_STD{0u << 21};       /**< Standard 1 bit SPI frame format */
+constexpr inline std::uint32_t SPI_FRF_DUAL{1u << 21};      /**< Dual 2 bit SPI frame format */
+constexpr inline std::uint32_t SPI_FRF_QUAD{2u << 21};      /**< Quad 4 bit SPI frame format */
+constexpr inline std::uint32_t SPI_FRF_MASK{3u << 21};      /**< SPI frame format mask */
+/**
+ * @brief Format DFS_32 field to CTRLR0 register
+ * @param bits data frame size in bits, 4 to 32
+ * @return formatted DFS_32 field
+ */
+constexpr inline std::uint32_t DFS_32(std::uint32_t bits) {
+  return (bits - 1) << 16;
+}
+constexpr inline std::uint32_t SRL{1u << 11};             /**< Shift register loop, test mode */
+constexpr inline std::uint32_t SLV_OE{1u << 10};          /**< Slave output enable */
+constexpr inline std::uint32_t TMOD_TX_AND_RX{0u << 8};   /**< Transmit and receive */
+constexpr inline std::uint32_t TMOD_TX_ONLY{1u << 8};     /**< Transmit only */
+constexpr inline std::uint32_t TMOD_RX_ONLY{2u << 8};     /**< Receive only */
+constexpr inline std::uint32_t TMOD_EEPROM_READ{3u << 8}; /**< EEPROM read mode, transmit command and address then receive */
+constexpr inline std::uint32_t SCPOL{1u << 7};            /**< Serial clock polarity */
+constexpr inline std::uint32_t SCPH{1u << 6};             /**< Serial clock phase */
+}  // namespace CTRLR0
+namespace CTRLR1 {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'FFFFu}; /**< Mask for allowed bits */
+/**
+ * @brief Format NDF field to CTRLR1 register
+ * @param frames number of data frames to receive minus one
+ * @return formatted NDF field
+ */
+constexpr inline std::uint32_t NDF(std::uint32_t frames) {
+  return frames << 0;
+}
+}  // namespace CTRLR1
+namespace SSIENR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t SSI_EN{1u << 0};             /**< SSI enable */
+}  // namespace SSIENR
+namespace SER {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0001u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t SER{1u << 0};                /**< Slave select enable */
+}  // namespace SER
+namespace BAUDR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'FFFFu}; /**< Mask for allowed bits */
+/**
+ * @brief Format SCKDV field to BAUDR register
+ * @param divider clock divider, even value from 2 to 65534
+ * @return formatted SCKDV field
+ */
+constexpr inline std::uint32_t SCKDV(std::uint32_t divider) {
+  return divider << 0;
+}
+}  // namespace BAUDR
+namespace SR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'007Fu}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t DCOL{1u << 6};               /**< Data collision error */
+constexpr inline std::uint32_t TXE{1u << 5};                /**< Transmission error */
+constexpr inline std::uint32_t RFF{1u << 4};                /**< Receive FIFO full */
+constexpr inline std::uint32_t RFNE{1u << 3};               /**< Receive FIFO not empty */
+constexpr inline std::uint32_t TFE{1u << 2};                /**< Transmit FIFO empty */
+constexpr inline std::uint32_t TFNF{1u << 1};               /**< Transmit FIFO not full */
+constexpr inline std::uint32_t BUSY{1u << 0};               /**< SSI busy */
+}  // namespace SR
+namespace DMACR {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'0003u}; /**< Mask for allowed bits */
+constexpr inline std::uint32_t TDMAE{1u << 1};              /**< Transmit DMA enable */
+constexpr inline std::uint32_t RDMAE{1u << 0};              /**< Receive DMA enable */
+}  // namespace DMACR
+namespace RX_SAMPLE_DLY {
+constexpr inline std::uint32_t RESERVED_MASK{0x0000'00FFu}; /**< Mask for allowed bits */
+}  // namespace RX_SAMPLE_DLY
+namespace SPI_CTRLR0 {
+constexpr inline std::uint32_t RESERVED_MASK{0xFF07'FB3Fu}; /**< Mask for allowed bits */
+/**
+ * @brief Format XIP_CMD field to SPI_CTRLR0 register
+ * @param command instruction sent in XIP mode, or mode bits when INST_L is zero
+ * @return formatted XIP_CMD field
+ */
+constexpr inline std::uint32_t XIP_CMD(std::uint32_t command) {
+  return command << 24;
+}
+constexpr inline std::uint32_t SPI_RXDS_EN{1u << 18}; /**< Read data strobe enable */
+constexpr inline std::uint32_t INST_DDR_EN{1u << 17}; /**< Instruction DDR transfer enable */
+constexpr inline std::uint32_t SPI_DDR_EN{1u << 16};  /**< SPI DDR transfer enable */
+/**
+ * @brief Format WAIT_CYCLES field to SPI_CTRLR0 register
+ * @param cycles wait cycles between control frame transmit and data receive, 0 to 31
+ * @return formatted WAIT_CYCLES field
+ */
+constexpr inline std::uint32_t WAIT_CYCLES(std::uint32_t cycles) {
+  return cycles << 11;
+}
+constexpr inline std::uint32_t INST_L_NONE{0u << 8}; /**< No instruction */
+constexpr inline std::uint32_t INST_L_4B{1u << 8};   /**< 4 bit instruction */
+constexpr inline std::uint32_t INST_L_8B{2u << 8};   /**< 8 bit instruction */
+constexpr inline std::uint32_t INST_L_16B{3u << 8};  /**< 16 bit instruction */
+/**
+ * @brief Format ADDR_L field to SPI_CTRLR0 register
+ * @param bits address length including mode bits, multiple of 4 up to 60
+ * @return formatted ADDR_L field
+ */
+constexpr inline std::uint32_t ADDR_L(std::uint32_t bits) {
+  return (bits / 4) << 2;
+}
+constexpr inline std::uint32_t TRANS_TYPE_1C1A{0u << 0}; /**< Command and address in standard SPI */
+constexpr inline std::uint32_t TRANS_TYPE_1C2A{1u << 0}; /**< Command in standard SPI, address in SPI_FRF format */
+constexpr inline std::uint32_t TRANS_TYPE_2C2A{2u << 0}; /**< Command and address in SPI_FRF format */
+}  // namespace SPI_CTRLR0
 }  // namespace libMcuHw::xipSsi
-#endif
\ No newline at end of file
+#endif
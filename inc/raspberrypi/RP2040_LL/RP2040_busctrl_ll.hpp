@@ -13,8 +13,55 @@
 namespace libMcuLL::busctrl {
 namespace hardware = libMcuHw::busctrl;
 /**
- * @brief
- * @tparam busctrlAddress_
+ * @brief bus masters that can be given high priority
+ */
+enum busMasters : std::uint32_t {
+  PROC0 = hardware::BUS_PRIORITY::PROC0, /**< Processor 0 */
+  PROC1 = hardware::BUS_PRIORITY::PROC1, /**< Processor 1 */
+  DMA_R = hardware::BUS_PRIORITY::DMA_R, /**< DMA read master */
+  DMA_W = hardware::BUS_PRIORITY::DMA_W, /**< DMA write master */
+};
+/**
+ * @brief performance counters
+ */
+enum class perfCounters : std::uint32_t {
+  COUNTER0 = 0, /**< performance counter 0 */
+  COUNTER1 = 1, /**< performance counter 1 */
+  COUNTER2 = 2, /**< performance counter 2 */
+  COUNTER3 = 3, /**< performance counter 3 */
+};
+/**
+ * @brief bus fabric targets the arbiters count accesses for
+ */
+enum class busTargets : std::uint32_t {
+  APB = hardware::PERFSEL::APB,           /**< APB bridge */
+  FASTPERI = hardware::PERFSEL::FASTPERI, /**< Fast peripherals */
+  SRAM5 = hardware::PERFSEL::SRAM5,       /**< SRAM5 */
+  SRAM4 = hardware::PERFSEL::SRAM4,       /**< SRAM4 */
+  SRAM3 = hardware::PERFSEL::SRAM3,       /**< SRAM3 */
+  SRAM2 = hardware::PERFSEL::SRAM2,       /**< SRAM2 */
+  SRAM1 = hardware::PERFSEL::SRAM1,       /**< SRAM1 */
+  SRAM0 = hardware::PERFSEL::SRAM0,       /**< SRAM0 */
+  XIP_MAIN = hardware::PERFSEL::XIP_MAIN, /**< XIP */
+  ROM = hardware::PERFSEL::ROM,           /**< ROM */
+};
+/**
+ * @brief performance counter events
+ */
+enum class perfEvents : std::uint32_t {
+  ACCESS,    /**< all accesses to the target */
+  CONTESTED, /**< accesses to the target that had to wait for another master */
+};
+/**
+ * @brief access counts of a bus target
+ */
+struct contention {
+  std::uint32_t accesses;  /**< all accesses */
+  std::uint32_t contested; /**< accesses that waited for another master */
+};
+/**
+ * @brief Bus fabric priority and performance counters
+ * @tparam busctrlAddress_ peripheral base address
  */
 template <libMcu::busCtrlBaseAddress const& busctrlAddress_>
 struct busctrl : libMcu::peripheralBase {
@@ -22,6 +69,72 @@ struct busctrl : libMcu::peripheralBase {
    * @brief Base initialization function
    */
   constexpr void init() {}
+  /**
+   * @brief give bus masters high priority in arbitration, other masters get low priority
+   * @param masters bit set of masters, see busMasters enum
+   */
+  static void setPriority(std::uint32_t masters) {
+    busctrlPeripheral()->BUS_PRIORITY = masters & hardware::BUS_PRIORITY::RESERVED_MASK;
+  }
+  /**
+   * @brief check if the last priority change has taken effect
+   * @return true when the new priorities are used
+   */
+  static bool isPriorityApplied() {
+    return (busctrlPeripheral()->BUS_PRIORITY_ACK & hardware::BUS_PRIORITY_ACK::ACK) != 0;
+  }
+  /**
+   * @brief clear a performance counter and start counting an event
+   * @param counter performance counter to use
+   * @param target bus target to count accesses of
+   * @param event which accesses to count
+   */
+  static void start(perfCounters counter, busTargets target, perfEvents event) {
+    std::uint32_t index = static_cast<std::uint32_t>(counter);
+    std::uint32_t select = static_cast<std::uint32_t>(target);
+    // contested events directly precede the access event of the same target
+    if (event == perfEvents::CONTESTED)
+      select = select - 1;
+    busctrlPeripheral()->PERF[index].PERFSEL = hardware::PERFSEL::NONE;
+    busctrlPeripheral()->PERF[index].PERFCTR = 0;
+    busctrlPeripheral()->PERF[index].PERFSEL = select;
+  }
+  /**
+   * @brief stop a performance counter, its value is kept
+   * @param counter performance counter to stop
+   */
+  static void stop(perfCounters counter) {
+    busctrlPeripheral()->PERF[static_cast<std::uint32_t>(counter)].PERFSEL = hardware::PERFSEL::NONE;
+  }
+  /**
+   * @brief read a performance counter
+   * @param counter performance counter to read
+   * @return amount of events, saturates at 0xFFFFFF
+   */
+  static std::uint32_t read(perfCounters counter) {
+    return busctrlPeripheral()->PERF[static_cast<std::uint32_t>(counter)].PERFCTR & hardware::PERFCTR::RESERVED_MASK;
+  }
+  /**
+   * @brief start measuring all and contested accesses of a bus target with a pair of counters
+   * @param target bus target to measure
+   * @param accessCounter counter for all accesses
+   * @param contestedCounter counter for contested accesses
+   */
+  static void start(busTargets target, perfCounters accessCounter, perfCounters contestedCounter) {
+    start(accessCounter, target, perfEvents::ACCESS);
+    start(contestedCounter, target, perfEvents::CONTESTED);
+  }
+  /**
+   * @brief stop measuring a bus target and read the results
+   * @param accessCounter counter for all accesses
+   * @param contestedCounter counter for contested accesses
+   * @return access counts
+   */
+  static contention stop(perfCounters accessCounter, perfCounters contestedCounter) {
+    stop(accessCounter);
+    stop(contestedCounter);
+    return {read(accessCounter), read(contestedCounter)};
+  }
   /**
    * @brief get registers from peripheral
    * @return return pointer to peripheral
@@ -34,4 +147,4 @@ struct busctrl : libMcu::peripheralBase {
   static constexpr libMcu::hwAddressType busctrlAddress = busctrlAddress_; /**< peripheral address */
 };
 }  // namespace libMcuLL::busctrl
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file RP2040 clock tree software interface
+ */
+#ifndef RP2040_CLOCK_TREE_SW_HPP
+#define RP2040_CLOCK_TREE_SW_HPP
+
+namespace libMcuLL::clocks {
+/**
+ * @brief Clock tree setup, combines the crystal oscillator, PLLs, resets and clock generators
+ * @tparam clocksAddress_ clocks peripheral address
+ * @tparam xoscAddress_ crystal oscillator peripheral address
+ * @tparam pllSysAddress_ system PLL peripheral address
+ * @tparam pllUsbAddress_ USB PLL peripheral address
+ * @tparam resetsAddress_ resets peripheral address
+ */
+template <libMcu::clocksBaseAddress const& clocksAddress_, libMcu::xoscBaseAddress const& xoscAddress_,
+          libMcu::pllBaseAddress const& pllSysAddress_, libMcu::pllBaseAddress const& pllUsbAddress_,
+          libMcu::resetsBaseAddress const& resetsAddress_>
+struct clockTree : libMcu::peripheralBase {
+  /**
+   * @brief Setup the complete clock tree from a compile time configuration
+   *
+   * Moves clk_sys and clk_ref to their glitchless safe sources before touching the oscillator and PLLs, then brings up the
+   * crystal oscillator, the PLLs and switches every clock generator to its final source. All settings are constants, only the
+   * register writes and lock polls remain.
+   *
+   * @tparam config clock tree configuration, see libMcuHw::clock::clockTreeConfig
+   * @param timeout how many times to poll the oscillator, PLL and reset status
+   * @return NO_ERROR when all clocks are running, TIMEOUT when the oscillator, a PLL or a reset did not complete
+   */
+  template <auto& config>
+  libMcu::results setup(std::uint32_t timeout) {
+    clocksLL.clocksPeripheral()->CLK_SYS_RESUS_CTRL = 0;
+    clocksLL.setup(systemSources::REF, 1u, 0u);
+    clocksLL.setup(referenceSources::ROSC, 1u);
+    if (xoscLL.start(config.xoscStartupDelay, timeout) == 0)
+      return libMcu::results::TIMEOUT;
+    constexpr std::uint32_t pllResets{(config.sysPllUsed ? resets::PLL_SYS : 0u) | (config.usbPllUsed ? resets::PLL_USB : 0u)};
+    if constexpr (pllResets != 0) {
+      if (resetsLL.reset(pllResets, timeout) == 0)
+        return libMcu::results::TIMEOUT;
+    }
+    if constexpr (config.sysPllUsed) {
+      if (pllSysLL.start(config.pllSys.refDiv, config.pllSys.fbDiv, config.pllSys.postDiv1, config.pllSys.postDiv2, timeout) == 0)
+        return libMcu::results::TIMEOUT;
+    }
+    if constexpr (config.usbPllUsed) {
+      if (pllUsbLL.start(config.pllUsb.refDiv, config.pllUsb.fbDiv, config.pllUsb.postDiv1, config.pllUsb.postDiv2, timeout) == 0)
+        return libMcu::results::TIMEOUT;
+    }
+    clocksLL.setup(referenceSources::XOSC, 1u);
+    if constexpr (config.sysPllUsed)
+      clocksLL.setup(systemAuxSources::PLL_SYS, 1u, 0u, 1u);
+    // clk_sys is now final, generator delays are based on it
+    clocksLL.setup(peripheralSources::SYS, config.periDelay);
+    if constexpr (config.usbPllUsed) {
+      clocksLL.setup(usbSources::PLL_USB, 1u, config.usbDelay);
+      clocksLL.setup(adcSources::PLL_USB, 1u, config.adcDelay);
+    }
+    clocksLL.setup(rtcSources::XOSC, config.rtcDivider >> 8, config.rtcDivider & 0xFFu, config.rtcDelay);
+    return libMcu::results::NO_ERROR;
+  }
+
+ private:
+  clocks<clocksAddress_> clocksLL;                   /**< clock generators */
+  libMcuLL::xosc::xosc<xoscAddress_> xoscLL;         /**< crystal oscillator */
+  libMcuLL::pll::pll<pllSysAddress_> pllSysLL;       /**< system PLL */
+  libMcuLL::pll::pll<pllUsbAddress_> pllUsbLL;       /**< USB PLL */
+  libMcuLL::resets::resets<resetsAddress_> resetsLL; /**< peripheral resets */
+};
+}  // namespace libMcuLL::clocks
+#endif
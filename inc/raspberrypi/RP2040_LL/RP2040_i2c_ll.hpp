@@ -31,10 +31,12 @@ struct i2c : libMcu::peripheralBase {
   /**
    * @brief setup I2C to master mode
    * Taken from raspberry Pi Pico SDK and adapted
+   * @tparam clockConfig clock configuration, periFreq member is used as I2C clock
    * @param mode speed mode
    * @param bitRate wanted bitrate
    * @return actual bitrate
    */
+  template <auto& clockConfig>
   constexpr std::uint32_t setup(i2cModes mode, std::uint32_t bitRate) {
     i2cPeripheral()->IC_ENABLE = hardware::IC_ENABLE::ABORT;
     i2cPeripheral()->IC_CON = hardware::IC_CON::MASTER_MODE | static_cast<std::uint32_t>(mode) | hardware::IC_CON::IC_RESTART_EN |
@@ -46,7 +48,7 @@ struct i2c : libMcu::peripheralBase {
     i2cPeripheral()->IC_DMA_CR = hardware::IC_DMA_CR::RDMAE | hardware::IC_DMA_CR::TDMAE;  // enable DMA, harmless without DMA
 
     // set baudrate, taken from pico SDK
-    std::uint32_t frequencyInput = FREQ_PERI;
+    std::uint32_t frequencyInput = clockConfig.periFreq;
     // TODO there are some subtleties to I2C timing which we are completely ignoring here
     std::uint32_t period = (frequencyInput + bitRate / 2) / bitRate;
     std::uint32_t lcnt = period * 3 / 5;
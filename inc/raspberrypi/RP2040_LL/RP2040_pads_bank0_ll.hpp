@@ -16,6 +16,66 @@ namespace libMcuLL::padsBank0 {
 using namespace libMcuLL::pads;
 namespace hardware = libMcuHw::padsBank0;
 
+/**
+ * @brief Pad setting of a pin, for padsConfig, the defaults are the reset setting
+ * @tparam PIN pin type
+ * @tparam t_driveStrength Pin drive strength, see driveModes enum class
+ * @tparam t_pullUpEnable Enable pullup resistor
+ * @tparam t_pullDownEnable Enable pulldown resistor
+ * @tparam t_schmittOn Enable schmitt trigger on input
+ * @tparam t_fastSlew Set fast slew rate
+ */
+template <typename PIN, driveModes t_driveStrength = driveModes::DRIVE_4MA, bool t_pullUpEnable = false,
+          bool t_pullDownEnable = true, bool t_schmittOn = true, bool t_fastSlew = false>
+struct padConfig {
+  static constexpr std::uint8_t index{PIN::pinIndex}; /**< GPIO pad register index */
+  static constexpr std::uint32_t value{hardware::GPIO::IE | (t_pullUpEnable ? hardware::GPIO::PUE : 0u) |
+                                       (t_pullDownEnable ? hardware::GPIO::PDE : 0u) |
+                                       (t_schmittOn ? hardware::GPIO::SCHMITT : 0u) |
+                                       (t_fastSlew ? hardware::GPIO::SLEWFAST : 0u) |
+                                       hardware::GPIO::DRIVE(static_cast<std::uint32_t>(t_driveStrength))}; /**< pad value */
+  static constexpr bool isDefault{value == hardware::GPIO::DEFAULT}; /**< reset setting */
+};
+
+/**
+ * @brief Pad register index and value
+ */
+struct padSetting {
+  std::uint32_t index; /**< GPIO pad register index */
+  std::uint32_t value; /**< GPIO pad register value */
+};
+
+/**
+ * @brief Pad settings of a whole board, folded to a table of register values at compile time
+ *
+ * Pads that keep their reset setting are left out of the table, so apply it with padsBank0::setup once after reset. Fails
+ * to compile when a pad is configured more than once.
+ *
+ * @tparam PADS padConfig types of all pads
+ */
+template <typename... PADS>
+struct padsConfig {
+  static_assert(!libMcu::hasDuplicates(std::array<std::uint8_t, sizeof...(PADS)>{PADS::index...}),
+                "a pad is configured more than once!");
+  static constexpr std::size_t count{(0u + ... + (PADS::isDefault ? 0u : 1u))}; /**< pads that differ from reset */
+  /**
+   * @brief collect the settings of the pads that differ from reset
+   * @return register settings
+   */
+  static consteval std::array<padSetting, count> makeTable() {
+    std::array<padSetting, count> result{};
+    std::size_t entry = 0;
+    (
+      [&] {
+        if constexpr (!PADS::isDefault)
+          result[entry++] = padSetting{PADS::index, PADS::value};
+      }(),
+      ...);
+    return result;
+  }
+  static constexpr std::array<padSetting, count> table{makeTable()}; /**< register settings to apply */
+};
+
 /**
  * @brief
  * @tparam padsBank0Address_
@@ -47,6 +107,19 @@ struct padsBank0 : libMcu::peripheralBase {
     setting = setting | hardware::GPIO::DRIVE(static_cast<std::uint32_t>(driveStrength));
     padsBank0Peripheral()->GPIO[pin.pinIndex] = setting;
   }
+  /**
+   * @brief Setup all pads of a board
+   *
+   * Stores the precomputed register values, the registers are not read.
+   *
+   * @tparam PADS padConfig types of the configuration
+   * @param config configuration to apply
+   */
+  template <typename... PADS>
+  constexpr void setup([[maybe_unused]] const padsConfig<PADS...>& config) {
+    for (const padSetting& setting : padsConfig<PADS...>::table)
+      padsBank0Peripheral()->GPIO[setting.index] = setting.value;
+  }
   // TODO simplified setup methods
   /**
    * @brief get registers from peripheral
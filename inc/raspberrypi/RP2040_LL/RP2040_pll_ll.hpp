@@ -35,6 +35,16 @@ struct pll : libMcu::peripheralBase {
     pllPeripheralClear()->PWR = hardware::PWR::POSTDIVPD;
     return timeout;
   }
+  /**
+   * @brief start the PLL with settings computed at compile time
+   * @tparam config PLL configuration, see libMcuHw::clock::pllConfig
+   * @param timeout amount of lock polls before giving up
+   * @return remaining timeout, zero when the PLL did not lock
+   */
+  template <auto& config>
+  static inline uint32_t start(uint32_t timeout) {
+    return start(config.refDiv, config.fbDiv, config.postDiv1, config.postDiv2, timeout);
+  }
   /**
    * @brief get registers from peripheral
    * @return return pointer to peripheral
@@ -45,12 +45,14 @@ struct spi : libMcu::peripheralBase {
   constexpr void init() {}
   /**
    * @brief Setup SPI with motorola format
+   * @tparam clockConfig clock configuration, periFreq member is used as SPI clock
    * @param bitRate requested bit rate
    * @param waveform waveform to output, see sw::spi::waveforms
    * @return actual bit rate
    */
+  template <auto& clockConfig>
   constexpr std::uint32_t setupMaster(std::uint32_t bitRate, waveforms waveform) {
-    std::uint32_t actualBitRate = setBitRate(bitRate);
+    std::uint32_t actualBitRate = setBitRate<clockConfig>(bitRate);
     std::uint32_t cr0setting = spiPeripheral()->SSPCR0 & ~hardware::SSPCR0::FORMAT_MASK;
     cr0setting |= static_cast<std::uint32_t>(waveform) | hardware::SSPCR0::FRF_MOTOROLA;
     spiPeripheral()->SSPCR0 = cr0setting;
@@ -91,16 +93,18 @@ struct spi : libMcu::peripheralBase {
 
   /**
    * @brief Set the SPI peripheral bit rate
-   * Uses defined CLOCK_AHB to compute the actual bit rate
+   * @tparam clockConfig clock configuration, periFreq member is used as SPI clock
    * @param bitRate requested bit rate
    * @return actual bit rate
    */
+  template <auto& clockConfig>
   constexpr std::uint32_t setBitRate(std::uint32_t bitRate) {
+    constexpr std::uint32_t periFreq{clockConfig.periFreq};
     // compute divider and truncate so we can observe a possible round off
-    std::uint16_t divider = static_cast<std::uint16_t>(FREQ_PERI / 2 / bitRate);
+    std::uint16_t divider = static_cast<std::uint16_t>(periFreq / 2 / bitRate);
     spiPeripheral()->SSPCPSR = 2; /* divide by two as a minimum */
     spiPeripheral()->SSPCR0 = (spiPeripheral()->SSPCR0 & ~hardware::SSPCR0::SCR_MASK) | hardware::SSPCR0::SCR(divider);
-    return FREQ_PERI / 2 / divider;
+    return periFreq / 2 / divider;
   }
   /**
    * @brief get registers from peripheral
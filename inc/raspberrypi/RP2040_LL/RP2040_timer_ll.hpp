@@ -12,12 +12,156 @@
 
 namespace libMcuLL::timer {
 namespace hardware = libMcuHw::timer;
+/**
+ * @brief hardware alarms of the timer
+ */
+enum class alarms : std::uint32_t {
+  ALARM0 = 0, /**< Alarm 0, fires timerIrq0 */
+  ALARM1 = 1, /**< Alarm 1, fires timerIrq1 */
+  ALARM2 = 2, /**< Alarm 2, fires timerIrq2 */
+  ALARM3 = 3, /**< Alarm 3, fires timerIrq3 */
+};
+/**
+ * @brief 64 bit microsecond timer peripheral
+ * @tparam timerAddress_ base timer peripheral address
+ */
 template <libMcu::timerBaseAddress const& timerAddress_>
 struct timer : libMcu::peripheralBase {
   /**
    * @brief Base initialization function
    */
   constexpr void init() {}
+  /**
+   * @brief get the 64 bit timer value
+   *
+   * Uses the raw registers and rereads the high word until it is stable. Unlike the latched TIMELR/TIMEHR pair this is safe
+   * to use from both cores and from interrupts at the same time.
+   * @return time in microseconds
+   */
+  static std::uint64_t getTime() {
+    std::uint32_t high = timerPeripheral()->TIMERAWH;
+    while (true) {
+      std::uint32_t low = timerPeripheral()->TIMERAWL;
+      std::uint32_t nextHigh = timerPeripheral()->TIMERAWH;
+      if (high == nextHigh)
+        return (static_cast<std::uint64_t>(high) << 32) | low;
+      high = nextHigh;
+    }
+  }
+  /**
+   * @brief get the lower 32 bits of the timer value
+   * @return time in microseconds, wraps every 71 minutes
+   */
+  static std::uint32_t getTimeLow() {
+    return timerPeripheral()->TIMERAWL;
+  }
+  /**
+   * @brief set the 64 bit timer value
+   * @param time new time in microseconds
+   */
+  static void setTime(std::uint64_t time) {
+    timerPeripheral()->TIMELW = static_cast<std::uint32_t>(time);
+    timerPeripheral()->TIMEHW = static_cast<std::uint32_t>(time >> 32);
+  }
+  /**
+   * @brief busy wait for an amount of microseconds
+   * @param microseconds time to wait, up to 2^32 - 1 microseconds
+   */
+  static void delay(std::uint32_t microseconds) {
+    std::uint32_t start = getTimeLow();
+    while ((getTimeLow() - start) < microseconds)
+      ;
+  }
+  /**
+   * @brief busy wait until a point in time has been reached
+   * @param time time to wait for in microseconds
+   */
+  static void waitUntil(std::uint64_t time) {
+    while (getTime() < time)
+      ;
+  }
+  /**
+   * @brief pause or continue the timer
+   * @param pause true to pause the timer
+   */
+  static void pause(bool pause) {
+    timerPeripheral()->PAUSE = pause ? hardware::PAUSE::PAUSE : 0u;
+  }
+  /**
+   * @brief pause the timer when a core is halted by the debugger
+   * @param core0 pause when core 0 is halted
+   * @param core1 pause when core 1 is halted
+   */
+  static void debugPause(bool core0, bool core1) {
+    timerPeripheral()->DBGPAUSE = (core0 ? hardware::DBGPAUSE::DBG0 : 0u) | (core1 ? hardware::DBGPAUSE::DBG1 : 0u);
+  }
+  /**
+   * @brief arm an alarm, it fires when the lower 32 bits of the timer match
+   * @param alarm alarm to arm
+   * @param time lower 32 bits of the time to fire at
+   */
+  static void armAlarm(alarms alarm, std::uint32_t time) {
+    timerPeripheral()->ALARM[static_cast<std::uint32_t>(alarm)] = time;
+  }
+  /**
+   * @brief disarm an alarm
+   * @param alarm alarm to disarm
+   */
+  static void disarmAlarm(alarms alarm) {
+    timerPeripheral()->ARMED = hardware::ARMED::ALARM(static_cast<std::uint32_t>(alarm));
+  }
+  /**
+   * @brief check if an alarm is still armed
+   * @param alarm alarm to check
+   * @return true if armed, false if it fired or was disarmed
+   */
+  static bool isArmed(alarms alarm) {
+    return (timerPeripheral()->ARMED & hardware::ARMED::ALARM(static_cast<std::uint32_t>(alarm))) != 0;
+  }
+  /**
+   * @brief enable the interrupt of an alarm
+   * @param alarm alarm to enable the interrupt of
+   */
+  static void enableInterrupt(alarms alarm) {
+    timerPeripheralSet()->INTE = hardware::INTE::ALARM(static_cast<std::uint32_t>(alarm));
+  }
+  /**
+   * @brief disable the interrupt of an alarm
+   * @param alarm alarm to disable the interrupt of
+   */
+  static void disableInterrupt(alarms alarm) {
+    timerPeripheralClear()->INTE = hardware::INTE::ALARM(static_cast<std::uint32_t>(alarm));
+  }
+  /**
+   * @brief check if the interrupt of an alarm is enabled
+   * @param alarm alarm to check
+   * @return true if enabled
+   */
+  static bool isInterruptEnabled(alarms alarm) {
+    return (timerPeripheral()->INTE & hardware::INTE::ALARM(static_cast<std::uint32_t>(alarm))) != 0;
+  }
+  /**
+   * @brief force the interrupt of an alarm, stays active until cleared by clearInterrupt
+   * @param alarm alarm to force the interrupt of
+   */
+  static void forceInterrupt(alarms alarm) {
+    timerPeripheralSet()->INTF = hardware::INTF::ALARM(static_cast<std::uint32_t>(alarm));
+  }
+  /**
+   * @brief clear the raw and forced interrupt of an alarm
+   * @param alarm alarm to clear the interrupt of
+   */
+  static void clearInterrupt(alarms alarm) {
+    timerPeripheralClear()->INTF = hardware::INTF::ALARM(static_cast<std::uint32_t>(alarm));
+    timerPeripheral()->INTR = hardware::INTR::ALARM(static_cast<std::uint32_t>(alarm));
+  }
+  /**
+   * @brief get the masked interrupt status
+   * @return interrupt status, see hardware::INTS::ALARM
+   */
+  static std::uint32_t getInterruptStatus() {
+    return timerPeripheral()->INTS;
+  }
   /**
    * @brief get registers from peripheral
    * @return return pointer to peripheral
@@ -25,9 +169,169 @@ struct timer : libMcu::peripheralBase {
   static hardware::timer* timerPeripheral() {
     return reinterpret_cast<hardware::timer*>(timerAddress);
   }
+  /**
+   * @brief get registers from peripheral for atomic set access
+   * @return return pointer to peripheral
+   */
+  static hardware::timer* timerPeripheralSet() {
+    return reinterpret_cast<hardware::timer*>(timerAddress + libMcuHw::peripheralOffsetSet);
+  }
+  /**
+   * @brief get registers from peripheral for atomic Clear access
+   * @return return pointer to peripheral
+   */
+  static hardware::timer* timerPeripheralClear() {
+    return reinterpret_cast<hardware::timer*>(timerAddress + libMcuHw::peripheralOffsetClear);
+  }
+  /**
+   * @brief get registers from peripheral for atomic XOR access
+   * @return return pointer to peripheral
+   */
+  static hardware::timer* timerPeripheralXor() {
+    return reinterpret_cast<hardware::timer*>(timerAddress + libMcuHw::peripheralOffsetXor);
+  }
 
  private:
   static constexpr libMcu::hwAddressType timerAddress{timerAddress_}; /**< peripheral address */
 };
+
+/**
+ * @brief Software alarm queue running any number of deadlines from one hardware alarm
+ *
+ * Deadlines are kept sorted, the hardware alarm is always armed for the earliest one. Call isr from the interrupt handler of the
+ * hardware alarm and enable that interrupt in the NVIC. Callbacks run in interrupt context. Use one queue per hardware alarm,
+ * so up to four queues can run at different interrupt priorities. Schedule and cancel are safe against the queue interrupt on
+ * the core that handles it.
+ *
+ * @tparam timer_ reference to a timer peripheral instance
+ * @tparam alarm hardware alarm to use
+ * @tparam maxEntries maximum amount of pending deadlines
+ */
+template <auto& timer_, alarms alarm, std::size_t maxEntries>
+struct alarmQueue {
+  /**
+   * @brief clear the queue and enable the alarm interrupt
+   */
+  void init() {
+    timer_.disarmAlarm(alarm);
+    timer_.clearInterrupt(alarm);
+    count = 0;
+    timer_.enableInterrupt(alarm);
+  }
+  /**
+   * @brief schedule a callback at an absolute time
+   * @param deadline time in microseconds to run the callback at
+   * @param callback function to call from the alarm interrupt
+   * @return NO_ERROR when scheduled
+   * @return OVERRUN when the queue is full
+   */
+  libMcu::results schedule(std::uint64_t deadline, libMcu::isrLambda callback) {
+    timer_.disableInterrupt(alarm);
+    if (count == maxEntries) {
+      timer_.enableInterrupt(alarm);
+      return libMcu::results::OVERRUN;
+    }
+    // insertion sort, equal deadlines run in the order they were scheduled
+    std::size_t index = count;
+    while ((index > 0) && (entries[index - 1].deadline > deadline)) {
+      entries[index] = entries[index - 1];
+      index--;
+    }
+    entries[index] = {deadline, callback};
+    count++;
+    if (index == 0) {
+      if (!armNext())
+        timer_.forceInterrupt(alarm);
+    }
+    timer_.enableInterrupt(alarm);
+    return libMcu::results::NO_ERROR;
+  }
+  /**
+   * @brief schedule a callback relative to the current time
+   * @param microseconds delay from now in microseconds
+   * @param callback function to call from the alarm interrupt
+   * @return NO_ERROR when scheduled
+   * @return OVERRUN when the queue is full
+   */
+  libMcu::results scheduleIn(std::uint32_t microseconds, libMcu::isrLambda callback) {
+    return schedule(timer_.getTime() + microseconds, callback);
+  }
+  /**
+   * @brief remove all pending deadlines of a callback
+   * @param callback callback to remove
+   * @return DONE when at least one deadline was removed
+   * @return ERROR when the callback was not scheduled
+   */
+  libMcu::results cancel(libMcu::isrLambda callback) {
+    timer_.disableInterrupt(alarm);
+    std::size_t kept = 0;
+    for (std::size_t index = 0; index < count; index++) {
+      if (entries[index].callback != callback) {
+        entries[kept] = entries[index];
+        kept++;
+      }
+    }
+    bool removed = kept != count;
+    count = kept;
+    if (removed) {
+      if (!armNext())
+        timer_.forceInterrupt(alarm);
+    }
+    timer_.enableInterrupt(alarm);
+    return removed ? libMcu::results::DONE : libMcu::results::ERROR;
+  }
+  /**
+   * @brief amount of pending deadlines
+   * @return pending deadlines
+   */
+  std::size_t pending() const {
+    return count;
+  }
+  /**
+   * @brief call site for the alarm ISR
+   *
+   * Runs all expired callbacks and arms the hardware alarm for the next deadline.
+   */
+  void isr() {
+    timer_.clearInterrupt(alarm);
+    do {
+      std::uint64_t now = timer_.getTime();
+      while ((count > 0) && (entries[0].deadline <= now)) {
+        libMcu::isrLambda callback = entries[0].callback;
+        for (std::size_t index = 1; index < count; index++)
+          entries[index - 1] = entries[index];
+        count--;
+        callback();
+      }
+    } while (!armNext());
+  }
+
+ private:
+  /**
+   * @brief arm the hardware alarm for the earliest deadline
+   * @return true when armed or nothing is pending, false when the deadline has already passed
+   */
+  bool armNext() {
+    if (count == 0) {
+      timer_.disarmAlarm(alarm);
+      return true;
+    }
+    std::uint64_t deadline = entries[0].deadline;
+    // the alarm only compares the lower 32 bits, far deadlines fire early and get rearmed
+    timer_.armAlarm(alarm, static_cast<std::uint32_t>(deadline));
+    return timer_.getTime() < deadline;
+  }
+  /**
+   * @brief pending deadline
+   */
+  struct entry {
+    std::uint64_t deadline;      /**< time to run the callback at */
+    libMcu::isrLambda callback; /**< callback to run */
+  };
+  std::array<entry, maxEntries> entries{}; /**< pending deadlines sorted by time */
+  std::size_t count{0};                    /**< amount of pending deadlines */
+
+  static_assert(maxEntries > 0, "alarm queue needs at least one entry!");
+};
 }  // namespace libMcuLL::timer
-#endif
\ No newline at end of file
+#endif
@@ -13,6 +13,32 @@
 namespace libMcuLL::uart {
 namespace hardware = libMcuHw::uart;
 using namespace libMcuHw::uart;
+/**
+ * @brief amount of data bits per character
+ */
+enum class uartLength : std::uint32_t {
+  SIZE_5 = UARTLCR_H::WLEN_5, /**< 5 data bits */
+  SIZE_6 = UARTLCR_H::WLEN_6, /**< 6 data bits */
+  SIZE_7 = UARTLCR_H::WLEN_7, /**< 7 data bits */
+  SIZE_8 = UARTLCR_H::WLEN_8, /**< 8 data bits */
+};
+/**
+ * @brief Parity bit options
+ */
+enum class uartParity : std::uint32_t {
+  NONE = 0u,                                                /**< No parity */
+  EVEN = UARTLCR_H::PEN | UARTLCR_H::EPS,                   /**< Even parity */
+  ODD = UARTLCR_H::PEN,                                     /**< Odd parity */
+  MARK = UARTLCR_H::PEN | UARTLCR_H::SPS,                   /**< Parity bit always one */
+  SPACE = UARTLCR_H::PEN | UARTLCR_H::EPS | UARTLCR_H::SPS, /**< Parity bit always zero */
+};
+/**
+ * @brief stop bit options
+ */
+enum class uartStop : std::uint32_t {
+  STOP_1 = 0u,              /**< 1 stop bit */
+  STOP_2 = UARTLCR_H::STP2, /**< 2 stop bits */
+};
 template <libMcu::uartBaseAddress const& uartAddress_>
 struct uart : libMcu::peripheralBase {
   /**
@@ -22,13 +48,16 @@ struct uart : libMcu::peripheralBase {
   /**
    * @brief setup UART to 8N1
    * Taken from raspberry Pi Pico SDK
+   * @tparam clockConfig clock configuration, periFreq member is used as UART clock
    * @param baudrate requested baud rate
    * @return actual baud rate
    */
+  template <auto& clockConfig>
   constexpr std::uint32_t setup(std::uint32_t baudrate) {
+    constexpr std::uint32_t periFreq{clockConfig.periFreq};
     uartPeripheralClear()->UARTCR = UARTCR::TXE | UARTCR::RXE | UARTCR::UARTEN;
     // baud rate calculations
-    std::uint32_t divisor = (8 * FREQ_PERI / baudrate);
+    std::uint32_t divisor = (8 * periFreq / baudrate);
     std::uint32_t divIntegral = divisor >> 7;
     std::uint32_t divFractional;
     if (divIntegral == 0) {
@@ -49,9 +78,37 @@ struct uart : libMcu::peripheralBase {
     uartPeripheral()->UARTLCR_H = UARTLCR_H::WLEN_8 | UARTLCR_H::FEN;
     uartPeripheral()->UARTCR = UARTCR::TXE | UARTCR::RXE | UARTCR::UARTEN;
     uartPeripheral()->UARTDMACR = UARTDMACR::TXDMAE | UARTDMACR::RXDMAE;
-    return (4 * FREQ_PERI) / (64 * divIntegral + divFractional);
+    return (4 * periFreq) / (64 * divIntegral + divFractional);
+  }
+  /**
+   * @brief setup UART with divisors computed at compile time
+   *
+   * Fails to compile when the baud rate can not be reached within the allowed error.
+   *
+   * @tparam clockConfig clock configuration, periFreq member is used as UART clock
+   * @tparam baudRate requested baud rate
+   * @tparam length data bits per character
+   * @tparam parity parity bit setting
+   * @tparam stop amount of stop bits
+   * @tparam maxError largest acceptable baud rate error in Hz, default is 1%
+   * @return actual baud rate
+   */
+  template <auto& clockConfig, std::uint32_t baudRate, uartLength length = uartLength::SIZE_8,
+            uartParity parity = uartParity::NONE, uartStop stop = uartStop::STOP_1, std::uint32_t maxError = baudRate / 100>
+  constexpr std::uint32_t setup() {
+    constexpr libMcuHw::clock::uartBaudSettings settings{libMcuHw::clock::findUartBaudSettings(clockConfig.periFreq, baudRate)};
+    static_assert(settings.ibrd != 0, "Baud rate out of range for this peripheral clock");
+    static_assert(settings.error <= maxError, "Baud rate error too large");
+    uartPeripheralClear()->UARTCR = UARTCR::TXE | UARTCR::RXE | UARTCR::UARTEN;
+    uartPeripheral()->UARTIBRD = settings.ibrd;
+    uartPeripheral()->UARTFBRD = settings.fbrd;
+    // LCR_H write latches in the divisors
+    uartPeripheral()->UARTLCR_H = static_cast<std::uint32_t>(length) | static_cast<std::uint32_t>(parity) |
+                                  static_cast<std::uint32_t>(stop) | UARTLCR_H::FEN;
+    uartPeripheral()->UARTCR = UARTCR::TXE | UARTCR::RXE | UARTCR::UARTEN;
+    uartPeripheral()->UARTDMACR = UARTDMACR::TXDMAE | UARTDMACR::RXDMAE;
+    return settings.baudRate;
   }
-  // TODO: add setup with format settings
   // write
   constexpr void write(std::span<const std::uint8_t> transmitBuffer) {
     for (const std::uint8_t& character : transmitBuffer) {
@@ -18,6 +18,121 @@ struct xipCtrl : libMcu::peripheralBase {
    * @brief Base initialization function
    */
   constexpr void init() {}
+  /**
+   * @brief enable the cache, cache as SRAM contents are lost
+   */
+  static void enableCache() {
+    xipCtrlPeripheral()->CTRL = xipCtrlPeripheral()->CTRL & ~hardware::CTRL::POWER_DOWN;
+    flush();
+    xipCtrlPeripheral()->CTRL = xipCtrlPeripheral()->CTRL | hardware::CTRL::EN;
+  }
+  /**
+   * @brief disable the cache, all flash accesses go directly to the flash and the cache memory is usable as SRAM
+   *
+   * Do not call this while executing from the cacheable flash alias when the timing of the loop matters, every fetch becomes a
+   * flash access.
+   */
+  static void disableCache() {
+    xipCtrlPeripheral()->CTRL = xipCtrlPeripheral()->CTRL & ~hardware::CTRL::EN;
+  }
+  /**
+   * @brief check if the cache is enabled
+   * @return true when enabled
+   */
+  static bool isCacheEnabled() {
+    return (xipCtrlPeripheral()->CTRL & hardware::CTRL::EN) != 0;
+  }
+  /**
+   * @brief get the cache memory as SRAM, only valid while the cache is disabled
+   * @return pointer to the start of cache memory, see libMcuHw::xip::cacheSramSize for its size
+   */
+  static std::uint32_t* getCacheSram() {
+    return reinterpret_cast<std::uint32_t*>(hardware::cacheSramAddress);
+  }
+  /**
+   * @brief power down the cache memory, the cache must be disabled first
+   */
+  static void powerDown() {
+    xipCtrlPeripheral()->CTRL = xipCtrlPeripheral()->CTRL | hardware::CTRL::POWER_DOWN;
+  }
+  /**
+   * @brief invalidate all cache lines and wait until the flush is complete
+   *
+   * Needed after the flash has been written, the cache is not coherent with flash programming.
+   */
+  static void flush() {
+    xipCtrlPeripheral()->FLUSH = hardware::FLUSH::FLUSH;
+    // reading FLUSH stalls until the flush is complete
+    static_cast<void>(xipCtrlPeripheral()->FLUSH);
+  }
+  /**
+   * @brief get the amount of cache hits since the last counter reset
+   * @return cache hits
+   */
+  static std::uint32_t getHitCount() {
+    return xipCtrlPeripheral()->CTR_HIT;
+  }
+  /**
+   * @brief get the amount of cacheable accesses since the last counter reset
+   * @return cache accesses, hits and misses
+   */
+  static std::uint32_t getAccessCount() {
+    return xipCtrlPeripheral()->CTR_ACC;
+  }
+  /**
+   * @brief clear the hit and access counters
+   */
+  static void resetCounters() {
+    xipCtrlPeripheral()->CTR_HIT = 0;
+    xipCtrlPeripheral()->CTR_ACC = 0;
+  }
+  /**
+   * @brief start streaming flash contents into the stream FIFO in the background
+   *
+   * The stream does not go through the cache. Read the FIFO with readStream or let a DMA channel paced by
+   * libMcuHw::xip::streamDreq copy from getStreamFifo.
+   *
+   * @param address flash address to start from, word aligned
+   * @param words amount of 32 bit words to stream, at most 0x3FFFFF
+   */
+  static void startStream(std::uint32_t address, std::uint32_t words) {
+    stopStream();
+    xipCtrlPeripheral()->STREAM_ADDR = address & hardware::STREAM_ADDR::RESERVED_MASK;
+    xipCtrlPeripheral()->STREAM_CTR = words & hardware::STREAM_CTR::RESERVED_MASK;
+  }
+  /**
+   * @brief stop a running stream and empty the stream FIFO
+   */
+  static void stopStream() {
+    xipCtrlPeripheral()->STREAM_CTR = 0;
+    while ((xipCtrlPeripheral()->STAT & hardware::STAT::FIFO_EMPTY) == 0)
+      static_cast<void>(xipCtrlPeripheral()->STREAM_FIFO);
+  }
+  /**
+   * @brief get the amount of words the stream still has to fetch from flash
+   * @return remaining words, zero when the stream is done
+   */
+  static std::uint32_t getStreamRemaining() {
+    return xipCtrlPeripheral()->STREAM_CTR & hardware::STREAM_CTR::RESERVED_MASK;
+  }
+  /**
+   * @brief read streamed words, blocking until all are received
+   * @param buffer destination for the streamed words
+   */
+  static void readStream(std::span<std::uint32_t> buffer) {
+    for (std::uint32_t& word : buffer) {
+      while (xipCtrlPeripheral()->STAT & hardware::STAT::FIFO_EMPTY)
+        libMcuLL::nop();
+      word = xipCtrlPeripheral()->STREAM_FIFO;
+    }
+  }
+  /**
+   * @brief stream FIFO address for DMA reads
+   * @return address of the stream FIFO on the fast bus alias
+   */
+  static volatile const std::uint32_t* getStreamFifo() {
+    return reinterpret_cast<volatile const std::uint32_t*>(hardware::streamFifoAddress);
+  }
   /**
    * @brief get registers from peripheral
    * @return return pointer to peripheral
@@ -30,4 +145,4 @@ struct xipCtrl : libMcu::peripheralBase {
   static constexpr libMcu::hwAddressType xipCtrlAddress{xipCtrlAddress_}; /**< peripheral address */
 };
 }  // namespace libMcuLL::xip
-#endif
\ No newline at end of file
+#endif
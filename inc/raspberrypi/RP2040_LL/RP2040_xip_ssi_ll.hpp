@@ -12,6 +12,31 @@
 
 namespace libMcuLL::xipSsi {
 namespace hardware = libMcuHw::xipSsi;
+/**
+ * @brief amount of data lines used for address and data
+ */
+enum class frameFormats : std::uint32_t {
+  STANDARD = hardware::CTRLR0::SPI_FRF_STD, /**< single data line */
+  DUAL = hardware::CTRLR0::SPI_FRF_DUAL,    /**< two data lines */
+  QUAD = hardware::CTRLR0::SPI_FRF_QUAD,    /**< four data lines */
+};
+/**
+ * @brief which parts of a transfer use the frame format
+ */
+enum class transferTypes : std::uint32_t {
+  CMD_ADDR_STANDARD = hardware::SPI_CTRLR0::TRANS_TYPE_1C1A, /**< command and address on a single line */
+  CMD_STANDARD = hardware::SPI_CTRLR0::TRANS_TYPE_1C2A,      /**< command on a single line, address in frame format */
+  CMD_ADDR_FORMAT = hardware::SPI_CTRLR0::TRANS_TYPE_2C2A,   /**< command and address in frame format */
+};
+/**
+ * @brief instruction length options
+ */
+enum class instructionLengths : std::uint32_t {
+  NONE = hardware::SPI_CTRLR0::INST_L_NONE,   /**< no instruction, continuous read mode */
+  BITS_4 = hardware::SPI_CTRLR0::INST_L_4B,   /**< 4 bit instruction */
+  BITS_8 = hardware::SPI_CTRLR0::INST_L_8B,   /**< 8 bit instruction */
+  BITS_16 = hardware::SPI_CTRLR0::INST_L_16B, /**< 16 bit instruction */
+};
 template <libMcu::xipSsiBaseAddress const& xipSsiAddress_>
 struct xipSsi : libMcu::peripheralBase {
   /**
@@ -19,10 +44,64 @@ struct xipSsi : libMcu::peripheralBase {
    */
   constexpr void init() {}
   /**
-   * @brief get registers from peripheral
+   * @brief setup the flash read command used for execute in place
+   *
+   * Flash is not accessible while the interface is being reconfigured, the caller must run from SRAM with interrupts that
+   * use flash disabled. This function is always inlined so it does not fetch instructions from flash itself, place the
+   * calling function in SRAM, for example with `__attribute__((section(".time_critical")))`. The flash device itself must
+   * already be configured for the chosen mode, for example with its quad enable bit set. Flush the XIP cache afterwards when
+   * the flash contents seen through the cache could have changed.
+   *
+   * @param format data lines used for address and data
+   * @param transfer which transfer parts use the frame format
+   * @param instruction instruction length
+   * @param command read command, or continuous read mode bits when the instruction length is NONE
+   * @param addressBits address length including mode bits, multiple of 4
+   * @param waitCycles dummy cycles between address and data
+   * @param clockDivider SSI clock divider from clk_sys, even value of 2 or more
+   */
+  __attribute__((always_inline)) static inline void setupXipRead(frameFormats format, transferTypes transfer,
+                                                                  instructionLengths instruction, std::uint32_t command,
+                                                                  std::uint32_t addressBits, std::uint32_t waitCycles,
+                                                                  std::uint32_t clockDivider) {
+    xipSsiPeripheral()->SSIENR = 0;
+    xipSsiPeripheral()->BAUDR = hardware::BAUDR::SCKDV(clockDivider);
+    xipSsiPeripheral()->CTRLR0 =
+      static_cast<std::uint32_t>(format) | hardware::CTRLR0::DFS_32(32) | hardware::CTRLR0::TMOD_EEPROM_READ;
+    xipSsiPeripheral()->CTRLR1 = hardware::CTRLR1::NDF(0);
+    xipSsiPeripheral()->SPI_CTRLR0 = hardware::SPI_CTRLR0::XIP_CMD(command) | hardware::SPI_CTRLR0::ADDR_L(addressBits) |
+                                     hardware::SPI_CTRLR0::WAIT_CYCLES(waitCycles) | static_cast<std::uint32_t>(instruction) |
+                                     static_cast<std::uint32_t>(transfer);
+    xipSsiPeripheral()->SSIENR = hardware::SSIENR::SSI_EN;
+  }
+  /**
+   * @brief change the SSI clock divider, same restrictions as setupXipRead apply, always inlined as well
+   * @param clockDivider SSI clock divider from clk_sys, even value of 2 or more
+   */
+  __attribute__((always_inline)) static inline void setClockDivider(std::uint32_t clockDivider) {
+    xipSsiPeripheral()->SSIENR = 0;
+    xipSsiPeripheral()->BAUDR = hardware::BAUDR::SCKDV(clockDivider);
+    xipSsiPeripheral()->SSIENR = hardware::SSIENR::SSI_EN;
+  }
+  /**
+   * @brief set the receive sample delay, needed at high flash clocks
+   * @param delay sample delay in clk_sys cycles
+   */
+  static void setRxSampleDelay(std::uint32_t delay) {
+    xipSsiPeripheral()->RX_SAMPLE_DLY = delay & hardware::RX_SAMPLE_DLY::RESERVED_MASK;
+  }
+  /**
+   * @brief check if the SSI is transferring
+   * @return true when busy
+   */
+  static bool isBusy() {
+    return (xipSsiPeripheral()->SR & hardware::SR::BUSY) != 0;
+  }
+  /**
+   * @brief get registers from peripheral, always inlined for setupXipRead and setClockDivider
    * @return return pointer to peripheral
    */
-  static hardware::xipSsi* xipSsiPeripheral() {
+  __attribute__((always_inline)) static inline hardware::xipSsi* xipSsiPeripheral() {
     return reinterpret_cast<hardware::xipSsi*>(xipSsiAddress);
   }
 
@@ -30,4 +109,4 @@ struct xipSsi : libMcu::peripheralBase {
   static constexpr libMcu::hwAddressType xipSsiAddress{xipSsiAddress_}; /**< peripheral address */
 };
 }  // namespace libMcuLL::xipSsi
-#endif
\ No newline at end of file
+#endif
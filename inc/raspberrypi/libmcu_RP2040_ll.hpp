@@ -153,6 +153,7 @@ constexpr inline libMcu::ppbBaseAddress ppbAddress{0xE000'0000u};
 // device peripheral specific headers go here
 // these need to go after registers namespace definitions as they are used here
 #include "RP2040_PINS/RP2040_pins.hpp"
+#include "RP2040_CLOCK/RP2040_clock.hpp"
 
 // includes that use the registers namespace go here
 // need to go after registers namespaces and device specific headers
@@ -186,5 +187,6 @@ constexpr inline libMcu::ppbBaseAddress ppbAddress{0xE000'0000u};
 #include "RP2040_LL/RP2040_xip_ctrl_ll.hpp"
 #include "RP2040_LL/RP2040_xip_ssi_ll.hpp"
 #include "RP2040_LL/RP2040_xosc_ll.hpp"
+#include "RP2040_LL/RP2040_clock_tree_ll.hpp"
 
 #endif
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC812 USART, SPI and I2C LL code against the host simulation models, checks the data and the register traffic
+ */
+#define CLOCK_AHB 12000000
+#define CLOCK_MAIN 12000000
+#include <nxp/libmcu_LPC812M101DH20_ll.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_usart_sim.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_spi_sim.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_i2c_sim.hpp>
+#include "test_check.hpp"
+
+libMcuSim::usart::usart<libMcuLL::hw::usart::usart> usartModel;
+libMcuSim::spi::spiLoopback<libMcuLL::hw::spi::spi> spiModel;
+libMcuSim::i2c::i2cTarget<libMcuLL::hw::i2c::i2c, 16> i2cModel;
+libMcuLL::sw::usart::usartSync<libMcuHw::usart0Address, std::uint8_t> usartPeripheral;
+libMcuLL::sw::spi::spiSync<libMcuHw::spi0Address, libMcuLL::sw::spi::chipEnables, std::uint16_t> spiPeripheral;
+libMcuLL::sw::i2c::i2c<libMcuHw::i2c0Address> i2cPeripheral;
+
+void testUsart() {
+  usartModel.resetCounters();
+  usartPeripheral.init(115200);
+  CHECK(usartModel.getReads() == 0);
+  CHECK(usartModel.getWrites() == 2);
+
+  usartModel.resetCounters();
+  usartPeripheral.write('B');
+  CHECK(usartModel.getWrites() == 1);
+  CHECK(usartModel.transmitted().size() == 1);
+  CHECK(usartModel.transmitted().front() == 'B');
+
+  usartModel.receive('A');
+  usartModel.resetCounters();
+  std::uint8_t data{0};
+  CHECK((usartPeripheral.status() & libMcuLL::hw::usart::STAT::RXRDY) != 0);
+  usartPeripheral.read(data);
+  CHECK(data == 'A');
+  CHECK((usartPeripheral.status() & libMcuLL::hw::usart::STAT::RXRDY) == 0);
+  CHECK(usartModel.getReads() == 3);
+  CHECK(usartModel.getWrites() == 0);
+
+  usartModel.loopback(true);
+  usartPeripheral.write('C');
+  usartPeripheral.read(data);
+  CHECK(data == 'C');
+  usartModel.loopback(false);
+}
+
+void testSpi() {
+  spiPeripheral.initMaster(1000000);
+  std::array<std::uint16_t, 2> transmit{0x1234, 0x56};
+  std::array<std::uint16_t, 2> receive{};
+  spiModel.resetCounters();
+  spiPeripheral.readWrite(libMcuLL::sw::spi::chipEnables::SSEL, transmit, receive, 24, true);
+  CHECK(receive[0] == 0x1234);
+  CHECK(receive[1] == 0x56);
+  CHECK(spiModel.getTransfers() == 1);
+  CHECK(spiModel.getWrites() == 2);
+  CHECK(spiModel.getReads() == 4);
+}
+
+void testI2c() {
+  i2cPeripheral.initMaster(100000, 100);
+  std::array<std::uint8_t, 3> writeData{2, 0xAA, 0xBB};
+  i2cModel.resetCounters();
+  i2cPeripheral.write({0x50}, writeData);
+  CHECK(i2cModel.memory()[2] == 0xAA);
+  CHECK(i2cModel.memory()[3] == 0xBB);
+  CHECK(i2cModel.getWrites() == 9);
+  CHECK(i2cModel.getReads() == 9);
+
+  std::array<std::uint8_t, 1> select{2};
+  std::array<std::uint8_t, 2> readData{};
+  i2cPeripheral.write({0x50}, select);
+  i2cModel.resetCounters();
+  i2cPeripheral.read({0x50}, readData);
+  CHECK(readData[0] == 0xAA);
+  CHECK(readData[1] == 0xBB);
+  CHECK(i2cModel.getWrites() == 4);
+  CHECK(i2cModel.getReads() == 7);
+
+  i2cModel.resetCounters();
+  i2cPeripheral.write({0x51}, writeData);
+  CHECK(i2cModel.getWrites() == 3);
+  CHECK(i2cModel.getReads() == 3);
+}
+
+int main() {
+  CHECK(usartModel.attach(libMcuHw::usart0Address) == libMcu::results::NO_ERROR);
+  CHECK(spiModel.attach(libMcuHw::spi0Address) == libMcu::results::NO_ERROR);
+  CHECK(i2cModel.attach(libMcuHw::i2c0Address, 0x50) == libMcu::results::NO_ERROR);
+  if (libMcuTest::failures != 0)
+    return libMcuTest::report("LPC812_host_sim");
+  testUsart();
+  testSpi();
+  testI2c();
+  return libMcuTest::report("LPC812_host_sim");
+}
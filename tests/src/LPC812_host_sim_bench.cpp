@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC812 USART, SPI and I2C LL register traffic per call and transfer size, measured with the host simulation models
+ *
+ * The register reads and writes are what the LL code costs on target, the host time per call is dominated by the fault
+ * handling of every register access and only shows relative changes between runs on the same host.
+ */
+#define CLOCK_AHB 12000000
+#define CLOCK_MAIN 12000000
+#include <nxp/libmcu_LPC812M101DH20_ll.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_usart_sim.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_spi_sim.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_i2c_sim.hpp>
+#include <chrono>
+#include <cstdio>
+
+libMcuSim::usart::usart<libMcuLL::hw::usart::usart> usartModel;
+libMcuSim::spi::spiLoopback<libMcuLL::hw::spi::spi> spiModel;
+libMcuSim::i2c::i2cTarget<libMcuLL::hw::i2c::i2c, 16> i2cModel;
+libMcuLL::sw::usart::usartSync<libMcuHw::usart0Address, std::uint8_t> usartPeripheral;
+libMcuLL::sw::spi::spiSync<libMcuHw::spi0Address, libMcuLL::sw::spi::chipEnables, std::uint16_t> spiPeripheral;
+libMcuLL::sw::i2c::i2c<libMcuHw::i2c0Address> i2cPeripheral;
+
+constexpr std::uint32_t repeats{1000}; /**< calls timed per measurement */
+
+/**
+ * @brief measure the register traffic and host time of a LL call and print it
+ * @tparam MODEL peripheral model type
+ * @tparam CALL callable type
+ * @param name name of the call
+ * @param size transfer size of the call
+ * @param model model of the peripheral the call uses
+ * @param call LL call to measure
+ */
+template <typename MODEL, typename CALL>
+void measure(const char *name, std::uint32_t size, MODEL &model, CALL call) {
+  model.resetCounters();
+  call();
+  std::uint32_t reads = model.getReads();
+  std::uint32_t writes = model.getWrites();
+  auto start = std::chrono::steady_clock::now();
+  for (std::uint32_t index = 0; index < repeats; index++)
+    call();
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  std::printf("%-20s %6u %8u %8u %12lld\n", name, size, reads, writes, static_cast<long long>(duration.count() / repeats));
+}
+
+int main() {
+  if ((usartModel.attach(libMcuHw::usart0Address) != libMcu::results::NO_ERROR) ||
+      (spiModel.attach(libMcuHw::spi0Address) != libMcu::results::NO_ERROR) ||
+      (i2cModel.attach(libMcuHw::i2c0Address, 0x50) != libMcu::results::NO_ERROR)) {
+    std::printf("LPC812_host_sim_bench: attaching the models failed\n");
+    return 1;
+  }
+  usartPeripheral.init(115200);
+  spiPeripheral.initMaster(1000000);
+  i2cPeripheral.initMaster(100000, 100);
+  std::printf("%-20s %6s %8s %8s %12s\n", "call", "size", "reads", "writes", "host ns");
+
+  std::uint8_t data{0};
+  measure("usart write", 1, usartModel, [] { usartPeripheral.write('B'); });
+  usartModel.transmitted().clear();
+  measure("usart read", 1, usartModel, [&data] {
+    usartModel.receive('A');
+    usartPeripheral.read(data);
+  });
+
+  std::array<std::uint16_t, 4> transmit{0x1234, 0x5678, 0x9ABC, 0xDEF0};
+  std::array<std::uint16_t, 4> receive{};
+  for (std::uint32_t bits : {8u, 16u, 24u, 32u, 64u}) {
+    measure("spi readWrite", bits, spiModel,
+            [&] { spiPeripheral.readWrite(libMcuLL::sw::spi::chipEnables::SSEL, transmit, receive, bits, true); });
+    spiModel.transmitted().clear();
+  }
+
+  std::array<std::uint8_t, 16> buffer{};
+  for (std::uint32_t bytes : {1u, 4u, 15u}) {
+    std::span<std::uint8_t> transfer = std::span<std::uint8_t>(buffer).first(bytes);
+    measure("i2c write", bytes, i2cModel, [transfer] { i2cPeripheral.write({0x50}, transfer); });
+    measure("i2c read", bytes, i2cModel, [transfer] { i2cPeripheral.read({0x50}, transfer); });
+  }
+  return 0;
+}
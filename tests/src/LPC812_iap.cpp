@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC812 IAP command sequences and page writer against the simulated boot ROM
+ */
+#define CLOCK_AHB 12000000
+#define CLOCK_MAIN 12000000
+#include <nxp/libmcu_LPC812M101DH20_ll.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_iap_sim.hpp>
+#include <cstring>
+#include <vector>
+#include "test_check.hpp"
+
+using rom = libMcuSim::iap::romEntry<16384>;
+using commands = libMcuLL::iap::commands;
+using status = libMcuLL::iap::status;
+
+static_assert(libMcuLL::iap::toResult(status::CMD_SUCCESS) == libMcu::results::NO_ERROR);
+static_assert(libMcuLL::iap::toResult(status::INVALID_SECTOR) == libMcu::results::INVALID_ADDRESS);
+static_assert(libMcuLL::iap::toResult(status::DST_ADDR_NOT_MAPPED) == libMcu::results::INVALID_ADDRESS);
+static_assert(libMcuLL::iap::toResult(status::BUSY) == libMcu::results::ERROR);
+static_assert(libMcuLL::iap::toResult(status::COMPARE_ERROR) == libMcu::results::ERROR);
+
+libMcuLL::iap::iap<rom> iapPeripheral;
+libMcuLL::iap::pageWriter<rom> writer;
+std::array<std::uint32_t, 16> page; /**< page contents, registered with the simulated ROM */
+
+const std::vector<commands> pageSequence{commands::PREPARE, commands::ERASE_PAGES, commands::PREPARE,
+                                         commands::COPY_RAM_TO_FLASH, commands::COMPARE};
+
+/**
+ * @brief compare flash with bytes
+ * @param address flash address
+ * @param text bytes to compare with
+ * @return true when equal
+ */
+bool flashEquals(std::uint32_t address, const char *text) {
+  std::array<std::uint32_t, 32> words;
+  std::size_t length = std::strlen(text);
+  rom::read(address & ~3u, words);
+  return std::memcmp(reinterpret_cast<const std::uint8_t *>(words.data()) + (address & 3u), text, length) == 0;
+}
+
+/**
+ * @brief write a string with the page writer
+ * @param address flash address
+ * @param text bytes to write
+ * @return result of the write
+ */
+libMcu::results writeText(std::uint32_t address, const char *text) {
+  return writer.write(address, std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(text), std::strlen(text)));
+}
+
+void testCommands() {
+  rom::reset();
+  page.fill(0x1234'5678u);
+  std::uint32_t mismatch{0};
+  CHECK(iapPeripheral.eraseSectors(2, 2) == status::SECTOR_NOT_PREPARED);
+  CHECK(iapPeripheral.copyToFlash(2048, page) == status::SECTOR_NOT_PREPARED);
+  CHECK(iapPeripheral.prepare(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.copyToFlash(2048, page) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.copyToFlash(2048 + 64, page) == status::SECTOR_NOT_PREPARED);
+  CHECK(iapPeripheral.compare(2048, page, mismatch) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.blankCheck(2, 2) == status::SECTOR_NOT_BLANK);
+  CHECK(iapPeripheral.prepare(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.eraseSectors(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.blankCheck(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.compare(2048, page, mismatch) == status::COMPARE_ERROR);
+  CHECK(mismatch == 0);
+  CHECK(iapPeripheral.prepare(3, 2) == status::INVALID_SECTOR);
+  CHECK(iapPeripheral.prepare(16, 16) == status::INVALID_SECTOR);
+  CHECK(iapPeripheral.prepare(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.copyToFlash(2048 + 4, page) == status::DST_ADDR_ERROR);
+  CHECK(iapPeripheral.copyToFlash(2048, std::span<const std::uint32_t>(page).first(4)) == status::COUNT_ERROR);
+}
+
+void testRamMapping() {
+  rom::reset();
+  std::vector<std::uint32_t> unmapped(16, 0u);
+  std::uint32_t mismatch{0};
+  // buffers that are not registered are refused instead of guessing their host address
+  CHECK(iapPeripheral.prepare(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.copyToFlash(2048, unmapped) == status::SRC_ADDR_NOT_MAPPED);
+  CHECK(iapPeripheral.compare(2048, unmapped, mismatch) == status::ADDR_NOT_MAPPED);
+  CHECK(iapPeripheral.blankCheck(2, 2) == status::CMD_SUCCESS);
+  rom::mapRam(unmapped.data(), unmapped.size() * sizeof(std::uint32_t));
+  CHECK(iapPeripheral.prepare(2, 2) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.copyToFlash(2048, unmapped) == status::CMD_SUCCESS);
+  CHECK(iapPeripheral.compare(2048, unmapped, mismatch) == status::CMD_SUCCESS);
+  // a buffer that runs past the end of its region is refused
+  CHECK(iapPeripheral.compare(2048, std::span<const std::uint32_t>(unmapped.data() + 8, 16), mismatch) ==
+        status::ADDR_NOT_MAPPED);
+  rom::unmapRam(unmapped.data());
+  CHECK(iapPeripheral.compare(2048, unmapped, mismatch) == status::ADDR_NOT_MAPPED);
+}
+
+void testPageWriter() {
+  rom::reset();
+  writer.init(12000000);
+  // writes within one page are buffered and programmed as one page
+  CHECK(writeText(1000, "abcd") == libMcu::results::NO_ERROR);
+  CHECK(writeText(1004, "efgh") == libMcu::results::NO_ERROR);
+  CHECK(writeText(1008, "ijkl") == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog().empty());
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog() == pageSequence);
+  CHECK(flashEquals(1000, "abcdefghijkl"));
+  // a write crossing a page boundary programs the first page when it moves to the next one
+  rom::clearLog();
+  CHECK(writeText(1020, "0123456789") == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog() == pageSequence);
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog().size() == 2 * pageSequence.size());
+  CHECK(flashEquals(1000, "abcdefghijkl"));
+  CHECK(flashEquals(1020, "0123456789"));
+  // unchanged contents are not programmed
+  rom::clearLog();
+  CHECK(writeText(1022, "2345") == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog().empty());
+  // flushing twice programs once
+  CHECK(writeText(1030, "xy") == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog() == pageSequence);
+}
+
+void testPageWriterErrors() {
+  rom::reset();
+  writer.init(12000000);
+  // a failing erase stops the sequence, the page stays buffered and the next flush retries it
+  rom::fail(commands::ERASE_PAGES, status::BUSY);
+  CHECK(writeText(2000, "retry") == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::ERROR);
+  CHECK((rom::getLog() == std::vector<commands>{commands::PREPARE, commands::ERASE_PAGES}));
+  rom::clearLog();
+  CHECK(writer.flush() == libMcu::results::NO_ERROR);
+  CHECK(rom::getLog() == pageSequence);
+  CHECK(flashEquals(2000, "retry"));
+  // a failing verify is reported
+  rom::fail(commands::COMPARE, status::COMPARE_ERROR);
+  CHECK(writeText(2010, "check") == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::ERROR);
+  // prepare refuses a page outside the flash, flush and the next write moving to another page report it
+  rom::reset();
+  writer.init(12000000);
+  CHECK(writeText(16384, "outside") == libMcu::results::NO_ERROR);
+  CHECK(writer.flush() == libMcu::results::INVALID_ADDRESS);
+  CHECK((rom::getLog() == std::vector<commands>{commands::PREPARE}));
+  CHECK(writeText(0, "inside") == libMcu::results::INVALID_ADDRESS);
+}
+
+int main() {
+  rom::mapRam(&page, sizeof(page));
+  rom::mapRam(&writer, sizeof(writer));
+  testCommands();
+  testRamMapping();
+  testPageWriter();
+  testPageWriterErrors();
+  return libMcuTest::report("LPC812_iap");
+}
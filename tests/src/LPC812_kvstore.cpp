@@ -0,0 +1,258 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file LPC812 key value store against the simulated flash array, with resets and power loss at every flash operation
+ */
+#define CLOCK_AHB 12000000
+#define CLOCK_MAIN 12000000
+#include <nxp/libmcu_LPC812M101DH20_ll.hpp>
+#include <nxp/LPC8XX_SIM/LPC8XX_flash_sim.hpp>
+#include <map>
+#include <vector>
+#include "test_check.hpp"
+
+using flash = libMcuSim::flash::flashArray<16384>;
+using value = std::vector<std::uint8_t>;
+using reference = std::map<std::uint32_t, value>;
+
+constexpr std::array<std::uint8_t, 9> crcCheck{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+static_assert(libMcuLL::kvstore::softwareCrc{}.crc32(crcCheck) == 0xCBF4'3926u);
+
+/**
+ * @brief operation on the store
+ */
+struct operation {
+  std::uint32_t key; /**< key to change */
+  bool remove;       /**< remove the key instead of writing value */
+  value contents;    /**< value to write */
+};
+
+/**
+ * @brief pseudo random numbers, the same sequence on every host
+ */
+struct randomNumbers {
+  std::uint32_t next(std::uint32_t range) {
+    state = state * 1103515245u + 12345u;
+    return ((state >> 16) & 0x7FFFu) % range;
+  }
+  std::uint32_t state{1}; /**< generator state */
+};
+
+/**
+ * @brief make a sequence of writes and removals, values are written unchanged now and then
+ * @param maxKeys amount of keys
+ * @param count amount of operations
+ * @param seed random seed
+ * @return operations
+ */
+std::vector<operation> makeOperations(std::uint32_t maxKeys, std::size_t count, std::uint32_t seed) {
+  randomNumbers generator{seed};
+  std::vector<operation> operations;
+  std::map<std::uint32_t, value> last;
+  while (operations.size() < count) {
+    operation step{generator.next(maxKeys), generator.next(8) == 0, {}};
+    if (!step.remove) {
+      if (last.count(step.key) && generator.next(4) == 0) {
+        step.contents = last[step.key];
+      } else {
+        step.contents.resize(generator.next(libMcuLL::kvstore::maxValueSize + 1));
+        for (std::uint8_t &byte : step.contents)
+          byte = static_cast<std::uint8_t>(generator.next(256));
+      }
+      last[step.key] = step.contents;
+    }
+    operations.push_back(step);
+  }
+  return operations;
+}
+
+/**
+ * @brief apply an operation to the reference
+ * @param contents reference contents
+ * @param step operation
+ */
+void applyTo(reference &contents, const operation &step) {
+  if (step.remove)
+    contents.erase(step.key);
+  else
+    contents[step.key] = step.contents;
+}
+
+/**
+ * @brief key value store test for a store size
+ * @tparam t_firstSector first flash sector of the store
+ * @tparam t_sectorCount sectors used by the store
+ * @tparam t_maxKeys amount of keys
+ */
+template <std::uint32_t t_firstSector, std::uint32_t t_sectorCount, std::uint32_t t_maxKeys>
+struct storeTest {
+  using store = libMcuLL::kvstore::store<t_firstSector, t_sectorCount, t_maxKeys, flash>;
+
+  /**
+   * @brief compare a store with the reference
+   * @param kv store
+   * @param contents reference contents
+   * @return true when equal
+   */
+  static bool matches(store &kv, const reference &contents) {
+    for (std::uint32_t key = 0; key < t_maxKeys; key++) {
+      std::array<std::uint8_t, libMcuLL::kvstore::maxValueSize> buffer;
+      std::uint32_t length{0};
+      auto expected = contents.find(key);
+      if (expected == contents.end()) {
+        if (kv.contains(key))
+          return false;
+        continue;
+      }
+      if (kv.read(key, buffer, length) != libMcu::results::NO_ERROR)
+        return false;
+      if ((length != expected->second.size()) || !std::equal(expected->second.begin(), expected->second.end(), buffer.begin()))
+        return false;
+    }
+    return true;
+  }
+  /**
+   * @brief perform an operation on the store
+   * @param kv store
+   * @param step operation
+   * @return result of the store
+   */
+  static libMcu::results perform(store &kv, const operation &step) {
+    if (step.remove)
+      return kv.remove(step.key);
+    return kv.write(step.key, step.contents);
+  }
+  /**
+   * @brief every key written, then more writes than fit in a sector, with a reset after every write
+   */
+  static void testFull() {
+    flash::reset();
+    reference contents;
+    store kv;
+    CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+    for (std::uint32_t index = 0; index < 4 * libMcuLL::iap::pagesPerSector * t_sectorCount; index++) {
+      operation step{index % t_maxKeys, false, value(index % 9 + 1, static_cast<std::uint8_t>(index))};
+      CHECK(perform(kv, step) == libMcu::results::NO_ERROR);
+      applyTo(contents, step);
+      store restarted;
+      CHECK(restarted.init(12000000) == libMcu::results::NO_ERROR);
+      CHECK(matches(restarted, contents));
+    }
+    CHECK(matches(kv, contents));
+  }
+  /**
+   * @brief random operations, with a reset now and then, wear is spread over all sectors
+   */
+  static void testRandom() {
+    flash::reset();
+    reference contents;
+    store kv;
+    CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+    std::vector<operation> operations = makeOperations(t_maxKeys, 2000, 7);
+    for (std::size_t index = 0; index < operations.size(); index++) {
+      CHECK(perform(kv, operations[index]) == libMcu::results::NO_ERROR);
+      applyTo(contents, operations[index]);
+      if (index % 97 == 0) {
+        kv = store{};
+        CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+        CHECK(matches(kv, contents));
+      }
+    }
+    CHECK(matches(kv, contents));
+    store restarted;
+    CHECK(restarted.init(12000000) == libMcu::results::NO_ERROR);
+    CHECK(matches(restarted, contents));
+    std::uint32_t least = flash::getErases(t_firstSector);
+    std::uint32_t most = least;
+    for (std::uint32_t sector = t_firstSector; sector < t_firstSector + t_sectorCount; sector++) {
+      least = std::min(least, flash::getErases(sector));
+      most = std::max(most, flash::getErases(sector));
+    }
+    CHECK(least > 0);
+    CHECK(most - least <= 1);
+  }
+  /**
+   * @brief lose power at every flash operation of every step of an operation sequence
+   *
+   * After the power loss the store must hold the contents from before or after the interrupted step and keep working.
+   */
+  static void testPowerLoss() {
+    std::vector<operation> operations = makeOperations(t_maxKeys, 3 * libMcuLL::iap::pagesPerSector * t_sectorCount, 3);
+    // an operation erases and programs at most a sector header, all records of a sector and the new record
+    constexpr std::uint32_t maxFlashOperations = libMcuLL::iap::pagesPerSector + 3u;
+    for (std::size_t interrupted = 0; interrupted < operations.size(); interrupted++) {
+      for (std::uint32_t completed = 0; completed <= maxFlashOperations; completed++) {
+        flash::reset();
+        reference before;
+        {
+          store kv;
+          CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+          for (std::size_t index = 0; index < interrupted; index++) {
+            CHECK(perform(kv, operations[index]) == libMcu::results::NO_ERROR);
+            applyTo(before, operations[index]);
+          }
+          flash::losePowerAfter(completed);
+          (void)perform(kv, operations[interrupted]);
+          flash::restorePower();
+        }
+        reference after = before;
+        applyTo(after, operations[interrupted]);
+        store kv;
+        CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+        bool isBefore = matches(kv, before);
+        bool isAfter = matches(kv, after);
+        CHECK(isBefore || isAfter);
+        reference contents = isAfter ? after : before;
+        // the store keeps working, also through the next garbage collection
+        for (std::size_t index = interrupted + 1; index < operations.size(); index++) {
+          CHECK(perform(kv, operations[index]) == libMcu::results::NO_ERROR);
+          applyTo(contents, operations[index]);
+        }
+        CHECK(matches(kv, contents));
+        store restarted;
+        CHECK(restarted.init(12000000) == libMcu::results::NO_ERROR);
+        CHECK(matches(restarted, contents));
+        if (libMcuTest::failures != 0)
+          return;
+      }
+    }
+  }
+  /**
+   * @brief argument checks
+   */
+  static void testArguments() {
+    flash::reset();
+    store kv;
+    CHECK(kv.init(12000000) == libMcu::results::NO_ERROR);
+    value stored(10, 7);
+    std::array<std::uint8_t, 4> shortBuffer;
+    std::uint32_t length{0};
+    CHECK(kv.write(1, stored) == libMcu::results::NO_ERROR);
+    CHECK(kv.read(1, shortBuffer, length) == libMcu::results::OVERRUN);
+    CHECK(length == stored.size());
+    CHECK(kv.read(2, shortBuffer, length) == libMcu::results::ERROR);
+    CHECK(kv.write(t_maxKeys, stored) == libMcu::results::ERROR);
+    CHECK(kv.write(1, value(libMcuLL::kvstore::maxValueSize + 1)) == libMcu::results::ERROR);
+    CHECK(kv.remove(2) == libMcu::results::NO_ERROR);
+  }
+  /**
+   * @brief run all tests
+   */
+  static void run() {
+    testFull();
+    testRandom();
+    testPowerLoss();
+    testArguments();
+  }
+};
+
+int main() {
+  storeTest<10, 2, libMcuLL::kvstore::recordsPerSector - 1u>::run();
+  storeTest<12, 3, libMcuLL::kvstore::recordsPerSector - 1u>::run();
+  storeTest<11, 5, 4>::run();
+  return libMcuTest::report("LPC812_kvstore");
+}
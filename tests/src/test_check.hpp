@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 Bart Bilos
+ * For conditions of distribution and use, see LICENSE file
+ */
+/**
+ * \file minimal checks for the host tests, a failed check is reported and makes the test return a non zero exit code
+ */
+#ifndef TEST_CHECK_HPP
+#define TEST_CHECK_HPP
+
+#include <cstdio>
+
+namespace libMcuTest {
+inline int failures{0}; /**< amount of failed checks */
+
+/**
+ * @brief report a failed check
+ * @param condition result of the check
+ * @param expression checked expression
+ * @param file source file of the check
+ * @param line source line of the check
+ */
+inline void check(bool condition, const char *expression, const char *file, int line) {
+  if (condition)
+    return;
+  std::printf("%s:%d: check failed: %s\n", file, line, expression);
+  failures++;
+}
+
+/**
+ * @brief print the test result
+ * @param name test name
+ * @return exit code, 0 when all checks passed
+ */
+inline int report(const char *name) {
+  std::printf("%s: %s\n", name, failures == 0 ? "passed" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
+}  // namespace libMcuTest
+
+#define CHECK(condition) libMcuTest::check((condition), #condition, __FILE__, __LINE__)
+
+#endif